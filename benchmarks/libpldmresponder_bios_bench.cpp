@@ -0,0 +1,751 @@
+#include "libpldmresponder/bios.hpp"
+#include "libpldmresponder/bios_parser.hpp"
+#include "utils.hpp"
+
+#include <endian.h>
+#include <stdlib.h>
+#include <systemd/sd-bus.h>
+#include <systemd/sd-event.h>
+#include <time.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#include "libpldm/base.h"
+#include "libpldm/bios.h"
+#include "libpldm/bios_table.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+namespace fs = std::filesystem;
+using Json = nlohmann::json;
+using namespace pldm::responder;
+
+constexpr auto benchService = "xyz.openbmc_project.BIOSBench";
+constexpr auto benchInterface = "xyz.openbmc_project.BIOSBench.Settings";
+constexpr auto benchObjectPath = "/xyz/openbmc_project/bios_bench/object";
+constexpr auto mapperService = "xyz.openbmc_project.ObjectMapper";
+constexpr auto mapperInterface = "xyz.openbmc_project.ObjectMapper";
+
+/** @brief Number of attributes backed by the properties of one D-Bus
+ *         object, so the values are read with fewer GetAll than attributes
+ */
+constexpr size_t attrsPerObject = 16;
+
+/** @brief Number of distinct possible value strings, shared by the enum
+ *         attributes as in libpldm_bios_table_bench
+ */
+constexpr size_t valueStrings = 64;
+
+/** @brief Value of a D-Bus property backing an attribute, a string for the
+ *         enum and string attributes and a uint64_t for the integers
+ */
+using PropertyValue = std::variant<uint64_t, std::string>;
+/** @brief Properties by name, of the objects by object path */
+using Objects = std::map<std::string, std::map<std::string, PropertyValue>>;
+
+/** @brief Write a synthetic BIOS configuration to the BIOS json files.
+ *
+ *  The mix of libpldm_bios_table_bench: 60% enums, 25% integers and 15%
+ *  strings, most enums are booleans, some have 4 possible values and a few
+ *  16. Every attribute is backed by a D-Bus property.
+ *
+ *  @param[in] dir - where the BIOS json files are written
+ *  @param[in] count - number of attributes
+ *  @return the D-Bus objects backing the attributes, with their values
+ */
+Objects makeConfig(const fs::path& dir, size_t count)
+{
+    std::mt19937 gen(count);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<size_t> values(0, valueStrings - 1);
+    std::uniform_int_distribution<uint64_t> integers(0, 1000);
+
+    Json enumAttrs = Json::array();
+    Json stringAttrs = Json::array();
+    Json integerAttrs = Json::array();
+    Objects objects;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto name = "Attr_" + std::to_string(i);
+        auto objectPath = benchObjectPath + std::to_string(i / attrsPerObject);
+        Json dBus = {{"object_path", objectPath},
+                     {"interface", benchInterface},
+                     {"property_name", name}};
+        auto& properties = objects[objectPath];
+
+        auto kind = percent(gen);
+        if (kind < 60)
+        {
+            auto fanOut = percent(gen);
+            size_t pvNum = fanOut < 70 ? 2 : fanOut < 90 ? 4 : 16;
+            auto first = values(gen);
+            Json possibleValues = Json::array();
+            for (size_t j = 0; j < pvNum; ++j)
+            {
+                possibleValues.push_back(
+                    "Value_" + std::to_string((first + j) % valueStrings));
+            }
+            dBus["property_type"] = "string";
+            dBus["property_values"] = possibleValues;
+            properties.emplace(name, possibleValues[0].get<std::string>());
+            Json defaultValues = Json::array({possibleValues[0]});
+            enumAttrs.push_back({{"attribute_name", name},
+                                 {"possible_values", possibleValues},
+                                 {"default_values", defaultValues},
+                                 {"dbus", dBus}});
+        }
+        else if (kind < 85)
+        {
+            dBus["property_type"] = "uint64_t";
+            properties.emplace(name, integers(gen));
+            integerAttrs.push_back({{"attribute_name", name},
+                                    {"lower_bound", 0},
+                                    {"upper_bound", 1000},
+                                    {"scalar_increment", 1},
+                                    {"default_value", 0},
+                                    {"dbus", dBus}});
+        }
+        else
+        {
+            dBus["property_type"] = "string";
+            properties.emplace(name, "value_" + std::to_string(i));
+            stringAttrs.push_back({{"attribute_name", name},
+                                   {"string_type", "ASCII"},
+                                   {"minimum_string_length", 0},
+                                   {"maximum_string_length", 64},
+                                   {"default_string_length", 7},
+                                   {"default_string", "default"},
+                                   {"dbus", dBus}});
+        }
+    }
+
+    std::ofstream(dir / bios_parser::bIOSEnumJson)
+        << Json{{"entries", enumAttrs}};
+    std::ofstream(dir / bios_parser::bIOSStrJson)
+        << Json{{"entries", stringAttrs}};
+    std::ofstream(dir / bios_parser::bIOSIntegerJson)
+        << Json{{"entries", integerAttrs}};
+    return objects;
+}
+
+/** @class DBusStandIn
+ *
+ *  Serves the D-Bus properties backing the synthetic attributes, and the
+ *  object mapper lookups of their service, from a connection and a thread
+ *  of its own. The Properties calls are answered after a latency, each call
+ *  independently of the others, as by services handling calls concurrently.
+ */
+class DBusStandIn
+{
+  public:
+    DBusStandIn(const DBusStandIn&) = delete;
+    DBusStandIn& operator=(const DBusStandIn&) = delete;
+
+    /** @brief Serve objects on the session bus
+     *
+     *  @param[in] objects - the D-Bus objects backing the attributes
+     *  @param[in] latency - how long a Properties call takes to answer
+     */
+    DBusStandIn(Objects objects, std::chrono::microseconds latency) :
+        objects(std::move(objects)), latency(latency)
+    {
+        sd_event* e = nullptr;
+        check(sd_event_new(&e), "sd_event_new");
+        event.reset(e);
+        sd_bus* b = nullptr;
+        check(sd_bus_open_user(&b), "sd_bus_open_user");
+        bus.reset(b);
+        check(sd_bus_attach_event(b, e, 0), "sd_bus_attach_event");
+        sd_bus_slot* s = nullptr;
+        check(sd_bus_add_fallback(b, &s, "/", onMessage, this),
+              "sd_bus_add_fallback");
+        slot.reset(s);
+        check(sd_bus_request_name(b, benchService, 0), "sd_bus_request_name");
+        check(sd_bus_request_name(b, mapperService, 0), "sd_bus_request_name");
+
+        thread = std::thread([this]() {
+            while (!stop)
+            {
+                sd_event_run(event.get(), 100000);
+            }
+        });
+    }
+
+    ~DBusStandIn()
+    {
+        stop = true;
+        thread.join();
+    }
+
+  private:
+    /** @struct DelayedCall
+     *
+     *  A Properties call, answered once its latency elapsed
+     */
+    struct DelayedCall
+    {
+        DBusStandIn* standIn;
+        sd_bus_message* msg;
+    };
+
+    static void check(int rc, const char* what)
+    {
+        if (rc < 0)
+        {
+            throw std::system_error(-rc, std::generic_category(), what);
+        }
+    }
+
+    static int onMessage(sd_bus_message* msg, void* userData,
+                         sd_bus_error* /*error*/)
+    {
+        auto standIn = static_cast<DBusStandIn*>(userData);
+        if (sd_bus_message_is_method_call(msg, mapperInterface,
+                                          "GetObject") > 0)
+        {
+            return standIn->answer(msg, &DBusStandIn::getObject);
+        }
+        if (!sd_bus_message_is_method_call(msg, pldm::utils::dbusProperties,
+                                           nullptr))
+        {
+            return 0;
+        }
+        if (standIn->latency.count() == 0)
+        {
+            return standIn->answer(msg, &DBusStandIn::properties);
+        }
+
+        uint64_t now = 0;
+        sd_event_now(standIn->event.get(), CLOCK_MONOTONIC, &now);
+        auto call = std::make_unique<DelayedCall>(
+            DelayedCall{standIn, sd_bus_message_ref(msg)});
+        sd_event_source* source = nullptr;
+        auto rc = sd_event_add_time(standIn->event.get(), &source,
+                                    CLOCK_MONOTONIC,
+                                    now + standIn->latency.count(), 0,
+                                    onLatency, call.get());
+        if (rc < 0)
+        {
+            sd_bus_message_unref(msg);
+            return rc;
+        }
+        call.release();
+        return 1;
+    }
+
+    static int onLatency(sd_event_source* source, uint64_t /*usec*/,
+                         void* userData)
+    {
+        std::unique_ptr<DelayedCall> call(static_cast<DelayedCall*>(userData));
+        call->standIn->answer(call->msg, &DBusStandIn::properties);
+        sd_bus_message_unref(call->msg);
+        sd_event_source_unref(source);
+        return 0;
+    }
+
+    /** @brief Answer a call, with an error if it could not be handled */
+    int answer(sd_bus_message* msg,
+               int (DBusStandIn::*handler)(sd_bus_message*))
+    {
+        auto rc = (this->*handler)(msg);
+        if (rc < 0)
+        {
+            sd_bus_reply_method_errno(msg, rc, nullptr);
+        }
+        return 1;
+    }
+
+    int getObject(sd_bus_message* msg)
+    {
+        const char* path = nullptr;
+        auto rc = sd_bus_message_read(msg, "s", &path);
+        if (rc < 0)
+        {
+            return rc;
+        }
+        if (!objects.count(path))
+        {
+            return -ENOENT;
+        }
+        return sd_bus_reply_method_return(msg, "a{sas}", 1, benchService, 1,
+                                          benchInterface);
+    }
+
+    int properties(sd_bus_message* msg)
+    {
+        const char* interface = nullptr;
+        auto rc = sd_bus_message_read(msg, "s", &interface);
+        if (rc < 0)
+        {
+            return rc;
+        }
+        auto object = objects.find(sd_bus_message_get_path(msg));
+        if (object == objects.end() || strcmp(interface, benchInterface))
+        {
+            return -ENOENT;
+        }
+        auto& properties = object->second;
+
+        if (sd_bus_message_is_method_call(msg, nullptr, "GetAll") > 0)
+        {
+            Message reply(nullptr, sd_bus_message_unref);
+            sd_bus_message* m = nullptr;
+            rc = sd_bus_message_new_method_return(msg, &m);
+            reply.reset(m);
+            rc = rc < 0 ? rc : appendProperties(m, properties);
+            return rc < 0 ? rc : sd_bus_send(nullptr, m, nullptr);
+        }
+
+        const char* name = nullptr;
+        rc = sd_bus_message_read(msg, "s", &name);
+        if (rc < 0)
+        {
+            return rc;
+        }
+        auto property = properties.find(name);
+        if (property == properties.end())
+        {
+            return -ENOENT;
+        }
+
+        if (sd_bus_message_is_method_call(msg, nullptr, "Get") > 0)
+        {
+            Message reply(nullptr, sd_bus_message_unref);
+            sd_bus_message* m = nullptr;
+            rc = sd_bus_message_new_method_return(msg, &m);
+            reply.reset(m);
+            rc = rc < 0 ? rc : appendValue(m, property->second);
+            return rc < 0 ? rc : sd_bus_send(nullptr, m, nullptr);
+        }
+        if (sd_bus_message_is_method_call(msg, nullptr, "Set") > 0)
+        {
+            if (std::holds_alternative<uint64_t>(property->second))
+            {
+                uint64_t value = 0;
+                rc = sd_bus_message_read(msg, "v", "t", &value);
+                property->second = value;
+            }
+            else
+            {
+                const char* value = nullptr;
+                rc = sd_bus_message_read(msg, "v", "s", &value);
+                property->second = std::string(rc < 0 ? "" : value);
+            }
+            if (rc < 0)
+            {
+                return rc;
+            }
+            // Signalled before the reply, as a service would
+            rc = emitChanged(sd_bus_message_get_path(msg), *property);
+            return rc < 0 ? rc : sd_bus_reply_method_return(msg, "");
+        }
+        return -EOPNOTSUPP;
+    }
+
+    using Message =
+        std::unique_ptr<sd_bus_message, decltype(&sd_bus_message_unref)>;
+
+    static int appendValue(sd_bus_message* m, const PropertyValue& value)
+    {
+        if (auto integer = std::get_if<uint64_t>(&value))
+        {
+            return sd_bus_message_append(m, "v", "t", *integer);
+        }
+        return sd_bus_message_append(m, "v", "s",
+                                     std::get<std::string>(value).c_str());
+    }
+
+    static int appendProperties(
+        sd_bus_message* m,
+        const std::map<std::string, PropertyValue>& properties)
+    {
+        auto rc = sd_bus_message_open_container(m, 'a', "{sv}");
+        for (auto iter = properties.begin();
+             rc >= 0 && iter != properties.end(); ++iter)
+        {
+            rc = sd_bus_message_open_container(m, 'e', "sv");
+            rc = rc < 0 ? rc
+                        : sd_bus_message_append(m, "s", iter->first.c_str());
+            rc = rc < 0 ? rc : appendValue(m, iter->second);
+            rc = rc < 0 ? rc : sd_bus_message_close_container(m);
+        }
+        return rc < 0 ? rc : sd_bus_message_close_container(m);
+    }
+
+    int emitChanged(const char* path,
+                    const std::pair<const std::string, PropertyValue>& property)
+    {
+        Message signal(nullptr, sd_bus_message_unref);
+        sd_bus_message* m = nullptr;
+        auto rc = sd_bus_message_new_signal(bus.get(), &m, path,
+                                            pldm::utils::dbusProperties,
+                                            "PropertiesChanged");
+        signal.reset(m);
+        rc = rc < 0 ? rc : sd_bus_message_append(m, "s", benchInterface);
+        rc = rc < 0 ? rc
+                    : appendProperties(m, {{property.first, property.second}});
+        rc = rc < 0 ? rc : sd_bus_message_append(m, "as", 0);
+        return rc < 0 ? rc : sd_bus_send(bus.get(), m, nullptr);
+    }
+
+    Objects objects;
+    std::chrono::microseconds latency;
+    std::unique_ptr<sd_event, decltype(&sd_event_unref)> event{
+        nullptr, sd_event_unref};
+    std::unique_ptr<sd_bus, decltype(&sd_bus_flush_close_unref)> bus{
+        nullptr, sd_bus_flush_close_unref};
+    std::unique_ptr<sd_bus_slot, decltype(&sd_bus_slot_unref)> slot{
+        nullptr, sd_bus_slot_unref};
+    std::atomic<bool> stop{false};
+    std::thread thread;
+};
+
+using Request = std::vector<uint8_t>;
+
+Request getTableRequest(uint8_t tableType)
+{
+    Request request(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_REQ_BYTES);
+    encode_get_bios_table_req(0, 0, PLDM_GET_FIRSTPART, tableType,
+                              reinterpret_cast<pldm_msg*>(request.data()));
+    return request;
+}
+
+Request getAttrValueRequest(uint16_t attrHandle)
+{
+    Request request(sizeof(pldm_msg_hdr) +
+                    PLDM_GET_BIOS_ATTR_CURR_VAL_BY_HANDLE_REQ_BYTES);
+    auto req = reinterpret_cast<
+        pldm_get_bios_attribute_current_value_by_handle_req*>(
+        reinterpret_cast<pldm_msg*>(request.data())->payload);
+    req->transfer_handle = htole32(0);
+    req->transfer_op_flag = PLDM_GET_FIRSTPART;
+    req->attribute_handle = htole16(attrHandle);
+    return request;
+}
+
+Request setAttrValueRequest(uint16_t attrHandle, uint8_t attrType,
+                            uint8_t index)
+{
+    auto length = pldm_bios_table_attr_value_entry_encode_enum_length(1);
+    std::vector<uint8_t> entry(length);
+    pldm_bios_table_attr_value_entry_encode_enum(entry.data(), entry.size(),
+                                                 attrHandle, attrType, 1,
+                                                 &index);
+    Request request(sizeof(pldm_msg_hdr) +
+                    PLDM_SET_BIOS_ATTR_CURR_VAL_MIN_REQ_BYTES + length);
+    encode_set_bios_attribute_current_value_req(
+        0, 0, PLDM_START_AND_END, entry.data(), entry.size(),
+        reinterpret_cast<pldm_msg*>(request.data()),
+        request.size() - sizeof(pldm_msg_hdr));
+    return request;
+}
+
+/** @struct EnumAttr
+ *
+ *  An enum attribute of the attribute table, to set
+ */
+struct EnumAttr
+{
+    uint16_t handle;
+    uint8_t type;
+    uint8_t pvNum;
+};
+
+/** @class BIOSResponder
+ *
+ *  A bios::Handler over a synthetic configuration, the attribute values
+ *  served by a DBusStandIn
+ */
+class BIOSResponder
+{
+  public:
+    /** @brief Generate the configuration and serve its values
+     *
+     *  @param[in] count - number of attributes
+     *  @param[in] latency - how long a D-Bus property read or write takes
+     */
+    BIOSResponder(size_t count, std::chrono::microseconds latency)
+    {
+        char tmpdir[] = "/tmp/biosBench.XXXXXX";
+        dir = fs::path(mkdtemp(tmpdir));
+        fs::create_directory(dir / "jsons");
+        fs::create_directory(dir / "tables");
+        dBus = std::make_unique<DBusStandIn>(
+            makeConfig(dir / "jsons", count), latency);
+    }
+
+    ~BIOSResponder()
+    {
+        handler.reset();
+        bios_parser::resetConfig();
+        dBus.reset();
+        fs::remove_all(dir);
+    }
+
+    /** @brief Start a responder with no table built, nor persisted */
+    void start()
+    {
+        handler.reset();
+        fs::remove_all(dir / "tables");
+        fs::create_directory(dir / "tables");
+        bios_parser::resetConfig();
+        handler = std::make_unique<bios::Handler>((dir / "jsons").string(),
+                                                  (dir / "tables").string());
+    }
+
+    /** @brief Send a request to the handler
+     *
+     *  @return the completion code of the response
+     */
+    uint8_t handle(uint8_t command, const Request& request)
+    {
+        auto response = handler->handle(
+            command, reinterpret_cast<const pldm_msg*>(request.data()),
+            request.size() - sizeof(pldm_msg_hdr));
+        // What the event loop of pldmd does between requests, e.g. the
+        // PropertiesChanged of a value set
+        while (sd_bus_process(pldm::utils::DBusHandler::getBus().get(),
+                              nullptr) > 0)
+        {
+        }
+        lastResponse = std::move(response);
+        return reinterpret_cast<pldm_msg*>(lastResponse.data())->payload[0];
+    }
+
+    /** @brief Build the three tables, and find the attributes to request
+     *
+     *  @return false if a table could not be built
+     */
+    bool buildTables()
+    {
+        for (auto tableType : {PLDM_BIOS_STRING_TABLE, PLDM_BIOS_ATTR_TABLE,
+                               PLDM_BIOS_ATTR_VAL_TABLE})
+        {
+            if (handle(PLDM_GET_BIOS_TABLE, getTableRequest(tableType)) !=
+                PLDM_SUCCESS)
+            {
+                return false;
+            }
+            if (tableType == PLDM_BIOS_ATTR_TABLE)
+            {
+                findAttributes();
+            }
+        }
+        return true;
+    }
+
+    std::vector<uint16_t> attrHandles;
+    std::vector<EnumAttr> enumAttrs;
+
+  private:
+    void findAttributes()
+    {
+        uint8_t cc = 0;
+        uint32_t nextTransferHandle = 0;
+        uint8_t transferFlag = 0;
+        size_t offset = 0;
+        decode_get_bios_table_resp(
+            reinterpret_cast<pldm_msg*>(lastResponse.data()),
+            lastResponse.size() - sizeof(pldm_msg_hdr), &cc,
+            &nextTransferHandle, &transferFlag, &offset);
+        auto table = lastResponse.data() + sizeof(pldm_msg_hdr) + offset;
+        auto length = lastResponse.size() - sizeof(pldm_msg_hdr) - offset;
+
+        attrHandles.clear();
+        enumAttrs.clear();
+        std::unique_ptr<pldm_bios_table_iter,
+                        decltype(&pldm_bios_table_iter_free)>
+            iter(pldm_bios_table_iter_create(table, length,
+                                             PLDM_BIOS_ATTR_TABLE),
+                 pldm_bios_table_iter_free);
+        for (; !pldm_bios_table_iter_is_end(iter.get());
+             pldm_bios_table_iter_next(iter.get()))
+        {
+            auto entry = pldm_bios_table_iter_attr_entry_value(iter.get());
+            auto handle =
+                pldm_bios_table_attr_entry_decode_attribute_handle(entry);
+            attrHandles.push_back(handle);
+            if (entry->attr_type == PLDM_BIOS_ENUMERATION)
+            {
+                enumAttrs.push_back(
+                    {handle, entry->attr_type,
+                     pldm_bios_table_attr_entry_enum_decode_pv_num(entry)});
+            }
+        }
+    }
+
+    fs::path dir;
+    std::unique_ptr<DBusStandIn> dBus;
+    std::unique_ptr<bios::Handler> handler;
+    Response lastResponse;
+};
+
+} // namespace
+
+/* Args: attributes, D-Bus latency in microseconds */
+static void BM_BIOSBuildTables(benchmark::State& state)
+{
+    BIOSResponder responder(state.range(0),
+                            std::chrono::microseconds(state.range(1)));
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        responder.start();
+        state.ResumeTiming();
+        if (!responder.buildTables())
+        {
+            state.SkipWithError("GetBIOSTable failed");
+            break;
+        }
+    }
+    state.counters["attributes"] = state.range(0);
+}
+BENCHMARK(BM_BIOSBuildTables)
+    ->Args({500, 0})
+    ->Args({5000, 0})
+    ->Args({5000, 100})
+    ->Args({5000, 1000})
+    ->Unit(benchmark::kMillisecond);
+
+/* Args: attributes, table type */
+static void BM_BIOSGetTable(benchmark::State& state)
+{
+    BIOSResponder responder(state.range(0), std::chrono::microseconds(0));
+    responder.start();
+    if (!responder.buildTables())
+    {
+        state.SkipWithError("GetBIOSTable failed");
+        return;
+    }
+
+    auto request = getTableRequest(state.range(1));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            responder.handle(PLDM_GET_BIOS_TABLE, request));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = state.range(0);
+}
+BENCHMARK(BM_BIOSGetTable)
+    ->ArgsProduct({{500, 5000},
+                   {PLDM_BIOS_STRING_TABLE, PLDM_BIOS_ATTR_TABLE,
+                    PLDM_BIOS_ATTR_VAL_TABLE}});
+
+/* Args: attributes */
+static void BM_BIOSGetAttrValueByHandle(benchmark::State& state)
+{
+    BIOSResponder responder(state.range(0), std::chrono::microseconds(0));
+    responder.start();
+    if (!responder.buildTables())
+    {
+        state.SkipWithError("GetBIOSTable failed");
+        return;
+    }
+
+    std::mt19937 gen(0);
+    std::vector<Request> requests;
+    for (size_t i = 0; i < 1024; ++i)
+    {
+        std::uniform_int_distribution<size_t> pick(
+            0, responder.attrHandles.size() - 1);
+        requests.emplace_back(
+            getAttrValueRequest(responder.attrHandles[pick(gen)]));
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& request = requests[i++ % requests.size()];
+        if (responder.handle(PLDM_GET_BIOS_ATTRIBUTE_CURRENT_VALUE_BY_HANDLE,
+                             request) != PLDM_SUCCESS)
+        {
+            state.SkipWithError("GetBIOSAttributeCurrentValueByHandle failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = state.range(0);
+}
+BENCHMARK(BM_BIOSGetAttrValueByHandle)->Arg(500)->Arg(5000);
+
+/* Args: attributes, D-Bus latency in microseconds */
+static void BM_BIOSSetAttrValue(benchmark::State& state)
+{
+    BIOSResponder responder(state.range(0),
+                            std::chrono::microseconds(state.range(1)));
+    responder.start();
+    if (!responder.buildTables() || responder.enumAttrs.empty())
+    {
+        state.SkipWithError("GetBIOSTable failed");
+        return;
+    }
+
+    // Cycle through the attributes and their possible values, each request
+    // changes the value
+    std::vector<Request> requests;
+    for (size_t round = 1; round < 3; ++round)
+    {
+        for (const auto& attr : responder.enumAttrs)
+        {
+            requests.emplace_back(setAttrValueRequest(
+                attr.handle, attr.type, round % attr.pvNum));
+        }
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& request = requests[i++ % requests.size()];
+        if (responder.handle(PLDM_SET_BIOS_ATTRIBUTE_CURRENT_VALUE,
+                             request) != PLDM_SUCCESS)
+        {
+            state.SkipWithError("SetBIOSAttributeCurrentValue failed");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = state.range(0);
+}
+BENCHMARK(BM_BIOSSetAttrValue)
+    ->Args({500, 0})
+    ->Args({5000, 0})
+    ->Args({5000, 1000});
+
+int main(int argc, char** argv)
+{
+    // The responder and the D-Bus stand-in meet on the session bus, a
+    // private one when run by dbus-run-session
+    if (!getenv("DBUS_SESSION_BUS_ADDRESS"))
+    {
+        std::cerr << "No session bus, run under dbus-run-session\n";
+        return EXIT_FAILURE;
+    }
+    setenv("DBUS_STARTER_BUS_TYPE", "session", 1);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return EXIT_FAILURE;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    return EXIT_SUCCESS;
+}
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <endian.h>
+
 #include <cstring>
+#include <iterator>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -16,6 +20,302 @@ namespace utils
 
 using Table = std::vector<uint8_t>;
 
+/** @class PackedSpan
+ *  @brief View of an array of little-endian integers packed in a BIOS table
+ *         entry, e.g. the possible value handles of an enum attribute
+ *
+ *  The integers are unaligned and little-endian, the span decodes them as
+ *  they are read.
+ */
+template <typename T>
+class PackedSpan
+{
+  public:
+    static_assert(std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t>);
+
+    /** @class iterator
+     *  @brief Const forward iterator of a PackedSpan
+     */
+    class iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = T;
+
+        explicit iterator(const uint8_t* pos) noexcept : pos(pos)
+        {
+        }
+
+        T operator*() const noexcept
+        {
+            return decode(pos);
+        }
+
+        iterator& operator++() noexcept
+        {
+            pos += sizeof(T);
+            return *this;
+        }
+
+        bool operator==(const iterator& other) const noexcept
+        {
+            return pos == other.pos;
+        }
+
+        bool operator!=(const iterator& other) const noexcept
+        {
+            return pos != other.pos;
+        }
+
+      private:
+        const uint8_t* pos;
+    };
+
+    /** @brief Constructs PackedSpan
+     *
+     *  @param[in] data - Pointer to the first integer
+     *  @param[in] count - Number of integers
+     */
+    PackedSpan(const uint8_t* data, size_t count) noexcept :
+        data(data), count(count)
+    {
+    }
+
+    size_t size() const noexcept
+    {
+        return count;
+    }
+
+    bool empty() const noexcept
+    {
+        return count == 0;
+    }
+
+    /** @brief Get an integer, unchecked as std::vector::operator[] */
+    T operator[](size_t i) const noexcept
+    {
+        return decode(data + i * sizeof(T));
+    }
+
+    iterator begin() const noexcept
+    {
+        return iterator(data);
+    }
+
+    iterator end() const noexcept
+    {
+        return iterator(data + count * sizeof(T));
+    }
+
+  private:
+    static T decode(const uint8_t* pos) noexcept
+    {
+        T value;
+        std::memcpy(&value, pos, sizeof(value));
+        if constexpr (sizeof(T) == sizeof(uint16_t))
+        {
+            value = le16toh(value);
+        }
+        return value;
+    }
+
+    const uint8_t* data;
+    size_t count;
+};
+
+/** @class StringEntryView
+ *  @brief Typed view of a BIOS string table entry
+ *
+ *  Views decode fields from the table bytes on access. They don't copy
+ *  anything, they are only valid as long as the table they point in.
+ */
+class StringEntryView
+{
+  public:
+    explicit StringEntryView(
+        const pldm_bios_string_table_entry* entry) noexcept :
+        entry(entry)
+    {
+    }
+
+    uint16_t handle() const noexcept
+    {
+        return pldm_bios_table_string_entry_decode_handle(entry);
+    }
+
+    /** @brief Get the string, which is not NUL terminated in the table */
+    std::string_view string() const noexcept
+    {
+        return {entry->name,
+                pldm_bios_table_string_entry_decode_string_length(entry)};
+    }
+
+  private:
+    const pldm_bios_string_table_entry* entry;
+};
+
+/** @class AttrEntryView
+ *  @brief Typed view of a BIOS attribute table entry
+ *
+ *  The accessors of a given attribute type must only be called on entries of
+ *  that type, read-only or not.
+ */
+class AttrEntryView
+{
+  public:
+    explicit AttrEntryView(const pldm_bios_attr_table_entry* entry) noexcept :
+        entry(entry)
+    {
+    }
+
+    uint16_t handle() const noexcept
+    {
+        return pldm_bios_table_attr_entry_decode_attribute_handle(entry);
+    }
+
+    /** @brief Get the attribute type, with the read-only bit */
+    uint8_t type() const noexcept
+    {
+        return pldm_bios_table_attr_entry_decode_attribute_type(entry);
+    }
+
+    bool readOnly() const noexcept
+    {
+        return type() & 0x80;
+    }
+
+    uint16_t nameHandle() const noexcept
+    {
+        return pldm_bios_table_attr_entry_decode_string_handle(entry);
+    }
+
+    /** @brief Get the string handles of the possible values of an enum */
+    PackedSpan<uint16_t> pvHandles() const noexcept
+    {
+        return {entry->metadata + sizeof(uint8_t),
+                pldm_bios_table_attr_entry_enum_decode_pv_num(entry)};
+    }
+
+    /** @brief Get the indices in pvHandles() of the default values of an
+     *         enum
+     */
+    PackedSpan<uint8_t> defIndices() const noexcept
+    {
+        auto pvHdls = pvHandles();
+        auto defNum = entry->metadata + sizeof(uint8_t) +
+                      pvHdls.size() * sizeof(uint16_t);
+        return {defNum + sizeof(uint8_t), *defNum};
+    }
+
+    uint8_t stringType() const noexcept
+    {
+        return pldm_bios_table_attr_entry_string_decode_string_type(entry);
+    }
+
+    uint16_t minLength() const noexcept
+    {
+        return pldm_bios_table_attr_entry_string_decode_min_length(entry);
+    }
+
+    uint16_t maxLength() const noexcept
+    {
+        return pldm_bios_table_attr_entry_string_decode_max_length(entry);
+    }
+
+    /** @brief Get the default string of a string attribute */
+    std::string_view defString() const noexcept
+    {
+        // string type, minimum, maximum and default string lengths
+        constexpr size_t defStringOffset =
+            sizeof(uint8_t) + 3 * sizeof(uint16_t);
+        return {reinterpret_cast<const char*>(entry->metadata) +
+                    defStringOffset,
+                pldm_bios_table_attr_entry_string_decode_def_string_length(
+                    entry)};
+    }
+
+    /** @struct Integer
+     *  @brief Fields of an integer attribute
+     */
+    struct Integer
+    {
+        uint64_t lowerBound;
+        uint64_t upperBound;
+        uint32_t scalarIncrement;
+        uint64_t defaultValue;
+    };
+
+    Integer integer() const noexcept
+    {
+        Integer fields;
+        pldm_bios_table_attr_entry_integer_decode(
+            entry, &fields.lowerBound, &fields.upperBound,
+            &fields.scalarIncrement, &fields.defaultValue);
+        return fields;
+    }
+
+  private:
+    const pldm_bios_attr_table_entry* entry;
+};
+
+/** @class AttrValueEntryView
+ *  @brief Typed view of a BIOS attribute value table entry
+ *
+ *  The accessors of a given attribute type must only be called on entries of
+ *  that type, read-only or not.
+ */
+class AttrValueEntryView
+{
+  public:
+    explicit AttrValueEntryView(
+        const pldm_bios_attr_val_table_entry* entry) noexcept :
+        entry(entry)
+    {
+    }
+
+    uint16_t handle() const noexcept
+    {
+        return pldm_bios_table_attr_value_entry_decode_attribute_handle(entry);
+    }
+
+    /** @brief Get the attribute type, with the read-only bit */
+    uint8_t type() const noexcept
+    {
+        return pldm_bios_table_attr_value_entry_decode_attribute_type(entry);
+    }
+
+    /** @brief Get the indices of the current values of an enum, in the
+     *         possible values of its attribute
+     */
+    PackedSpan<uint8_t> currentIndices() const noexcept
+    {
+        return {entry->value + sizeof(uint8_t),
+                pldm_bios_table_attr_value_entry_enum_decode_number(entry)};
+    }
+
+    /** @brief Get the current string of a string attribute */
+    std::string_view currentString() const noexcept
+    {
+        variable_field currentString;
+        pldm_bios_table_attr_value_entry_string_decode_string(entry,
+                                                              &currentString);
+        return {reinterpret_cast<const char*>(currentString.ptr),
+                currentString.length};
+    }
+
+    /** @brief Get the current value of an integer attribute */
+    uint64_t currentValue() const noexcept
+    {
+        return pldm_bios_table_attr_value_entry_integer_decode_cv(entry);
+    }
+
+  private:
+    const pldm_bios_attr_val_table_entry* entry;
+};
+
 /** @class BIOSTableIter
  *  @brief Const Iterator of a BIOS Table
  */
@@ -31,7 +331,8 @@ class BIOSTableIter
     };
 
     /** @struct iterator
-     *  @brief iterator owns the BIOS table
+     *  @brief iterator over the BIOS table, it holds the C iterator by value
+     *         so traversals don't allocate
      */
     class iterator
     {
@@ -52,10 +353,9 @@ class BIOSTableIter
          *  @param[in] data - Pointer to a table
          *  @param[in] length - The length of the table
          */
-        explicit iterator(const void* data, size_t length) noexcept :
-            iter(pldm_bios_table_iter_create(data, length, tableType),
-                 pldm_bios_table_iter_free)
+        explicit iterator(const void* data, size_t length) noexcept
         {
+            pldm_bios_table_iter_init(&iter, data, length, tableType);
         }
 
         /** @brief Get the entry pointed by the iterator
@@ -65,7 +365,7 @@ class BIOSTableIter
         const T* operator*() const
         {
             return reinterpret_cast<const T*>(
-                pldm_bios_table_iter_value(iter.get()));
+                pldm_bios_table_iter_value(&iter));
         }
 
         /** @brief Make the iterator point to the next entry
@@ -74,7 +374,7 @@ class BIOSTableIter
          */
         iterator& operator++()
         {
-            pldm_bios_table_iter_next(iter.get());
+            pldm_bios_table_iter_next(&iter);
             return *this;
         }
 
@@ -84,7 +384,7 @@ class BIOSTableIter
          */
         bool operator==(const EndSentinel&) const
         {
-            return pldm_bios_table_iter_is_end(iter.get());
+            return pldm_bios_table_iter_is_end(&iter);
         }
 
         /** @brief Check if the iterator ends
@@ -97,9 +397,7 @@ class BIOSTableIter
         }
 
       private:
-        std::unique_ptr<pldm_bios_table_iter,
-                        decltype(&pldm_bios_table_iter_free)>
-            iter;
+        pldm_bios_table_iter iter;
     };
 
     /** @brief Constructors BIOSTableIterator
@@ -135,6 +433,93 @@ class BIOSTableIter
     size_t tableSize;
 };
 
+/** @class BIOSTableIndex
+ *  @brief Index of the entries of a BIOS Table by handle
+ *
+ *  The index holds offsets of the entries, it can be used to look up entries
+ *  in any copy of the table it was built from. Copies of the index share it,
+ *  an update made through one of them is seen by all.
+ */
+template <pldm_bios_table_types tableType>
+class BIOSTableIndex
+{
+  public:
+    using T = typename BIOSTableIter<tableType>::iterator::T;
+
+    /** @brief Constructs BIOSTableIndex, in a single pass over a table
+     *
+     *  @param[in] data - Pointer to a table
+     *  @param[in] length - The length of the table
+     */
+    BIOSTableIndex(const void* data, size_t length) :
+        index(pldm_bios_table_index_create(data, length, tableType),
+              pldm_bios_table_index_free)
+    {
+    }
+
+    /** @brief Find an entry by handle
+     *
+     *  @param[in] data - Pointer to the table the index was built from
+     *  @param[in] length - The length of the table
+     *  @param[in] handle - Handle of the entry
+     *  @return Pointer to the entry, nullptr if not found
+     */
+    const T* find(const void* data, size_t length, uint16_t handle) const
+    {
+        if constexpr (tableType == PLDM_BIOS_STRING_TABLE)
+        {
+            return pldm_bios_table_string_find_by_handle_index(
+                data, length, index.get(), handle);
+        }
+        else if constexpr (tableType == PLDM_BIOS_ATTR_TABLE)
+        {
+            return pldm_bios_table_attr_find_by_handle_index(
+                data, length, index.get(), handle);
+        }
+        else
+        {
+            return pldm_bios_table_attr_value_find_by_handle_index(
+                data, length, index.get(), handle);
+        }
+    }
+
+    /** @brief Find a string table entry by string
+     *
+     *  @param[in] data - Pointer to the table the index was built from
+     *  @param[in] length - The length of the table
+     *  @param[in] str - The string
+     *  @return Pointer to the entry, nullptr if not found
+     */
+    const T* find(const void* data, size_t length, const char* str) const
+    {
+        static_assert(tableType == PLDM_BIOS_STRING_TABLE);
+        return pldm_bios_table_string_find_by_string_index(data, length,
+                                                           index.get(), str);
+    }
+
+    /** @brief Update an attribute value table entry in place, the index
+     *         follows the entries that move
+     *
+     *  @param[in,out] data - Pointer to the table the index was built from
+     *  @param[in,out] length - The length of the table, assigned the length
+     *                          of the updated table
+     *  @param[in] size - Size of the buffer holding the table
+     *  @param[in] entry - Pointer to the new entry
+     *  @param[in] entryLength - Length of the new entry
+     *  @return pldm_completion_codes
+     */
+    int update(void* data, size_t* length, size_t size, const void* entry,
+               size_t entryLength)
+    {
+        static_assert(tableType == PLDM_BIOS_ATTR_VAL_TABLE);
+        return pldm_bios_table_attr_value_update_in_place_index(
+            data, length, size, index.get(), entry, entryLength);
+    }
+
+  private:
+    std::shared_ptr<pldm_bios_table_index> index;
+};
+
 } // namespace utils
 } // namespace bios
 } // namespace pldm
@@ -0,0 +1,496 @@
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libpldm/bios.h"
+#include "libpldm/bios_table.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+using Table = std::vector<uint8_t>;
+
+/** @brief Number of distinct possible value strings, shared by the enum
+ *         attributes as on a real BMC ("Enabled", "Disabled", ...)
+ */
+constexpr size_t valueStrings = 64;
+
+/** @brief Attribute of a synthetic BIOS configuration */
+struct Attribute
+{
+    uint8_t type;
+    std::vector<uint16_t> pvHandles; //!< possible values of an enum
+};
+
+/** @brief Synthetic string, attribute and attribute value tables */
+struct BIOSTables
+{
+    std::vector<std::string> strings;
+    std::vector<Attribute> attributes;
+    Table stringTable;
+    Table attrTable;
+    Table attrValueTable;
+    size_t attrValueEntriesLength; //!< without pad and checksum
+};
+
+/** @brief Make the attributes of a synthetic BIOS configuration.
+ *
+ *  60% enums, 25% integers and 15% strings. Most enums are booleans, some
+ *  have 4 possible values and a few 16, with the possible values drawn from
+ *  a pool of strings shared by all the attributes.
+ */
+BIOSTables makeConfig(size_t count)
+{
+    std::mt19937 gen(count);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::uniform_int_distribution<uint16_t> values(0, valueStrings - 1);
+
+    BIOSTables tables;
+    for (size_t i = 0; i < count; ++i)
+    {
+        tables.strings.emplace_back("Attribute_" + std::to_string(i));
+    }
+    for (size_t i = 0; i < valueStrings; ++i)
+    {
+        tables.strings.emplace_back("Value_" + std::to_string(i));
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        Attribute attr{};
+        auto kind = percent(gen);
+        if (kind < 60)
+        {
+            attr.type = PLDM_BIOS_ENUMERATION;
+            auto fanOut = percent(gen);
+            size_t pvNum = fanOut < 70 ? 2 : fanOut < 90 ? 4 : 16;
+            for (size_t j = 0; j < pvNum; ++j)
+            {
+                attr.pvHandles.push_back(count + values(gen));
+            }
+        }
+        else if (kind < 85)
+        {
+            attr.type = PLDM_BIOS_INTEGER;
+        }
+        else
+        {
+            attr.type = PLDM_BIOS_STRING;
+        }
+        tables.attributes.emplace_back(std::move(attr));
+    }
+    return tables;
+}
+
+/** @brief Build the tables of a configuration, sizing each table first so it
+ *         is built with a single allocation, as the responder does.
+ */
+void encodeTables(BIOSTables& tables)
+{
+    pldm_bios_table_builder builder;
+    size_t length = 0;
+
+    auto addStrings = [&tables](pldm_bios_table_builder& builder) {
+        for (const auto& str : tables.strings)
+        {
+            pldm_bios_table_builder_string_add(&builder, str.c_str(),
+                                               str.size(), nullptr);
+        }
+    };
+    pldm_bios_table_builder_init(&builder, nullptr, 0);
+    addStrings(builder);
+    pldm_bios_table_builder_finish(&builder, &length);
+    tables.stringTable.resize(length);
+    pldm_bios_table_builder_init(&builder, tables.stringTable.data(), length);
+    addStrings(builder);
+    pldm_bios_table_builder_finish(&builder, &length);
+
+    auto addAttributes = [&tables](pldm_bios_table_builder& builder) {
+        const uint8_t defIndex = 0;
+        static const char defString[] = "default";
+        for (size_t i = 0; i < tables.attributes.size(); ++i)
+        {
+            const auto& attr = tables.attributes[i];
+            uint16_t nameHandle = i;
+            switch (attr.type)
+            {
+                case PLDM_BIOS_ENUMERATION:
+                {
+                    pldm_bios_table_attr_entry_enum_info info = {
+                        nameHandle,
+                        false,
+                        static_cast<uint8_t>(attr.pvHandles.size()),
+                        attr.pvHandles.data(),
+                        1,
+                        &defIndex};
+                    pldm_bios_table_builder_attr_enum_add(&builder, &info,
+                                                          nullptr);
+                    break;
+                }
+                case PLDM_BIOS_INTEGER:
+                {
+                    pldm_bios_table_attr_entry_integer_info info = {
+                        nameHandle, false, 0, 100, 1, 5};
+                    pldm_bios_table_builder_attr_integer_add(&builder, &info,
+                                                             nullptr);
+                    break;
+                }
+                default:
+                {
+                    pldm_bios_table_attr_entry_string_info info = {
+                        nameHandle,     false, 1, 0, 32,
+                        sizeof(defString) - 1, defString};
+                    pldm_bios_table_builder_attr_string_add(&builder, &info,
+                                                            nullptr);
+                    break;
+                }
+            }
+        }
+    };
+    pldm_bios_table_builder_init(&builder, nullptr, 0);
+    addAttributes(builder);
+    pldm_bios_table_builder_finish(&builder, &length);
+    tables.attrTable.resize(length);
+    pldm_bios_table_builder_init(&builder, tables.attrTable.data(), length);
+    addAttributes(builder);
+    pldm_bios_table_builder_finish(&builder, &length);
+
+    static const char current[] = "current";
+    size_t entriesLength = 0;
+    for (const auto& attr : tables.attributes)
+    {
+        switch (attr.type)
+        {
+            case PLDM_BIOS_ENUMERATION:
+                entriesLength +=
+                    pldm_bios_table_attr_value_entry_encode_enum_length(1);
+                break;
+            case PLDM_BIOS_INTEGER:
+                entriesLength +=
+                    pldm_bios_table_attr_value_entry_encode_integer_length();
+                break;
+            default:
+                entriesLength +=
+                    pldm_bios_table_attr_value_entry_encode_string_length(
+                        sizeof(current) - 1);
+                break;
+        }
+    }
+    tables.attrValueTable.resize(
+        entriesLength + pldm_bios_table_pad_checksum_size(entriesLength));
+    auto entry = tables.attrValueTable.data();
+    for (size_t i = 0; i < tables.attributes.size(); ++i)
+    {
+        const uint8_t currIndex = 1;
+        size_t entryLength = 0;
+        switch (tables.attributes[i].type)
+        {
+            case PLDM_BIOS_ENUMERATION:
+                entryLength =
+                    pldm_bios_table_attr_value_entry_encode_enum_length(1);
+                pldm_bios_table_attr_value_entry_encode_enum(
+                    entry, entryLength, i, PLDM_BIOS_ENUMERATION, 1,
+                    &currIndex);
+                break;
+            case PLDM_BIOS_INTEGER:
+                entryLength =
+                    pldm_bios_table_attr_value_entry_encode_integer_length();
+                pldm_bios_table_attr_value_entry_encode_integer(
+                    entry, entryLength, i, PLDM_BIOS_INTEGER, 7);
+                break;
+            default:
+                entryLength =
+                    pldm_bios_table_attr_value_entry_encode_string_length(
+                        sizeof(current) - 1);
+                pldm_bios_table_attr_value_entry_encode_string(
+                    entry, entryLength, i, PLDM_BIOS_STRING,
+                    sizeof(current) - 1, current);
+                break;
+        }
+        entry += entryLength;
+    }
+    pldm_bios_table_append_pad_checksum(tables.attrValueTable.data(),
+                                        tables.attrValueTable.size(),
+                                        entriesLength);
+    tables.attrValueEntriesLength = entriesLength;
+}
+
+BIOSTables makeTables(size_t count)
+{
+    auto tables = makeConfig(count);
+    encodeTables(tables);
+    return tables;
+}
+
+/** @brief Random handles of the attributes to look up, the same sequence for
+ *         every benchmark of a given size
+ */
+std::vector<uint16_t> makeLookups(size_t count)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<uint16_t> handles(0, count - 1);
+    std::vector<uint16_t> lookups(1024);
+    std::generate(lookups.begin(), lookups.end(),
+                  [&]() { return handles(gen); });
+    return lookups;
+}
+
+void setAttributeCounters(benchmark::State& state, const BIOSTables& tables)
+{
+    state.SetItemsProcessed(state.iterations() * tables.attributes.size());
+    state.counters["attributes"] = tables.attributes.size();
+    state.counters["table_bytes"] = tables.stringTable.size() +
+                                    tables.attrTable.size() +
+                                    tables.attrValueTable.size();
+}
+
+} // namespace
+
+static void BM_BIOSTableEncode(benchmark::State& state)
+{
+    auto tables = makeConfig(state.range(0));
+    for (auto _ : state)
+    {
+        encodeTables(tables);
+        benchmark::DoNotOptimize(tables.attrValueTable.data());
+        state.PauseTiming();
+        Table().swap(tables.stringTable);
+        Table().swap(tables.attrTable);
+        Table().swap(tables.attrValueTable);
+        state.ResumeTiming();
+    }
+    encodeTables(tables);
+    setAttributeCounters(state, tables);
+}
+BENCHMARK(BM_BIOSTableEncode)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableIterate(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    for (auto _ : state)
+    {
+        pldm_bios_table_iter iter;
+        pldm_bios_table_iter_init(&iter, tables.stringTable.data(),
+                                  tables.stringTable.size(),
+                                  PLDM_BIOS_STRING_TABLE);
+        for (; !pldm_bios_table_iter_is_end(&iter);
+             pldm_bios_table_iter_next(&iter))
+        {
+            benchmark::DoNotOptimize(
+                pldm_bios_table_iter_string_entry_value(&iter));
+        }
+        pldm_bios_table_iter_init(&iter, tables.attrTable.data(),
+                                  tables.attrTable.size(),
+                                  PLDM_BIOS_ATTR_TABLE);
+        for (; !pldm_bios_table_iter_is_end(&iter);
+             pldm_bios_table_iter_next(&iter))
+        {
+            benchmark::DoNotOptimize(
+                pldm_bios_table_iter_attr_entry_value(&iter));
+        }
+        pldm_bios_table_iter_init(&iter, tables.attrValueTable.data(),
+                                  tables.attrValueTable.size(),
+                                  PLDM_BIOS_ATTR_VAL_TABLE);
+        for (; !pldm_bios_table_iter_is_end(&iter);
+             pldm_bios_table_iter_next(&iter))
+        {
+            benchmark::DoNotOptimize(
+                pldm_bios_table_iter_attr_value_entry_value(&iter));
+        }
+    }
+    setAttributeCounters(state, tables);
+}
+BENCHMARK(BM_BIOSTableIterate)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableFindByHandle(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto lookups = makeLookups(tables.attributes.size());
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(pldm_bios_table_attr_value_find_by_handle(
+            tables.attrValueTable.data(), tables.attrValueTable.size(),
+            lookups[i++ % lookups.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+}
+BENCHMARK(BM_BIOSTableFindByHandle)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableFindByHandleIndex(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto lookups = makeLookups(tables.attributes.size());
+    auto index = pldm_bios_table_index_create(tables.attrValueTable.data(),
+                                              tables.attrValueTable.size(),
+                                              PLDM_BIOS_ATTR_VAL_TABLE);
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            pldm_bios_table_attr_value_find_by_handle_index(
+                tables.attrValueTable.data(), tables.attrValueTable.size(),
+                index, lookups[i++ % lookups.size()]));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+    pldm_bios_table_index_free(index);
+}
+BENCHMARK(BM_BIOSTableFindByHandleIndex)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000);
+
+static void BM_BIOSTableFindByString(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto lookups = makeLookups(tables.attributes.size());
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& str = tables.strings[lookups[i++ % lookups.size()]];
+        benchmark::DoNotOptimize(pldm_bios_table_string_find_by_string(
+            tables.stringTable.data(), tables.stringTable.size(),
+            str.c_str()));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+}
+BENCHMARK(BM_BIOSTableFindByString)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableFindByStringIndex(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto lookups = makeLookups(tables.attributes.size());
+    auto index = pldm_bios_table_index_create(tables.stringTable.data(),
+                                              tables.stringTable.size(),
+                                              PLDM_BIOS_STRING_TABLE);
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& str = tables.strings[lookups[i++ % lookups.size()]];
+        benchmark::DoNotOptimize(pldm_bios_table_string_find_by_string_index(
+            tables.stringTable.data(), tables.stringTable.size(), index,
+            str.c_str()));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+    pldm_bios_table_index_free(index);
+}
+BENCHMARK(BM_BIOSTableFindByStringIndex)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000);
+
+/** @brief Make integer attribute value entries to set, for the random
+ *         attributes looked up
+ */
+std::vector<Table> makeUpdates(const BIOSTables& tables)
+{
+    std::vector<Table> updates;
+    for (auto handle : makeLookups(tables.attributes.size()))
+    {
+        if (tables.attributes[handle].type != PLDM_BIOS_INTEGER)
+        {
+            continue;
+        }
+        Table entry(pldm_bios_table_attr_value_entry_encode_integer_length());
+        pldm_bios_table_attr_value_entry_encode_integer(
+            entry.data(), entry.size(), handle, PLDM_BIOS_INTEGER,
+            updates.size() % 100);
+        updates.emplace_back(std::move(entry));
+    }
+    return updates;
+}
+
+static void BM_BIOSTableCopyAndUpdate(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto updates = makeUpdates(tables);
+    Table dest(tables.attrValueTable.size());
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& entry = updates[i++ % updates.size()];
+        auto destLength = dest.size();
+        pldm_bios_table_attr_value_copy_and_update(
+            tables.attrValueTable.data(), tables.attrValueTable.size(),
+            dest.data(), &destLength, entry.data(), entry.size());
+        benchmark::DoNotOptimize(dest.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * dest.size());
+    state.counters["attributes"] = tables.attributes.size();
+}
+BENCHMARK(BM_BIOSTableCopyAndUpdate)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableUpdateInPlace(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto updates = makeUpdates(tables);
+    auto& table = tables.attrValueTable;
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& entry = updates[i++ % updates.size()];
+        auto length = table.size();
+        pldm_bios_table_attr_value_update_in_place(
+            table.data(), &length, table.size(), entry.data(), entry.size());
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+}
+BENCHMARK(BM_BIOSTableUpdateInPlace)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_BIOSTableUpdateInPlaceIndex(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto updates = makeUpdates(tables);
+    auto& table = tables.attrValueTable;
+    auto index = pldm_bios_table_index_create(table.data(), table.size(),
+                                              PLDM_BIOS_ATTR_VAL_TABLE);
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto& entry = updates[i++ % updates.size()];
+        auto length = table.size();
+        pldm_bios_table_attr_value_update_in_place_index(
+            table.data(), &length, table.size(), index, entry.data(),
+            entry.size());
+        benchmark::DoNotOptimize(table.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["attributes"] = tables.attributes.size();
+    pldm_bios_table_index_free(index);
+}
+BENCHMARK(BM_BIOSTableUpdateInPlaceIndex)
+    ->RangeMultiplier(10)
+    ->Range(100, 10000);
+
+static void BM_BIOSTablePadChecksum(benchmark::State& state)
+{
+    auto tables = makeTables(state.range(0));
+    auto& table = tables.attrValueTable;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(pldm_bios_table_append_pad_checksum(
+            table.data(), table.size(), tables.attrValueEntriesLength));
+    }
+    state.SetBytesProcessed(state.iterations() * table.size());
+    state.counters["attributes"] = tables.attributes.size();
+}
+BENCHMARK(BM_BIOSTablePadChecksum)->RangeMultiplier(10)->Range(100, 10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "libpldm/pdr.h"
+#include "libpldm/platform.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+using Record = std::vector<uint8_t>;
+
+/** @brief Make a PDR of the given type with a body of the given size */
+Record makePdr(uint8_t type, size_t bodySize)
+{
+    Record pdr(sizeof(pldm_pdr_hdr) + bodySize, 0);
+    auto hdr = reinterpret_cast<pldm_pdr_hdr*>(pdr.data());
+    hdr->version = 1;
+    hdr->type = type;
+    hdr->length = bodySize;
+    std::fill(pdr.begin() + sizeof(pldm_pdr_hdr), pdr.end(), 0x5a);
+    return pdr;
+}
+
+/** @brief Make a synthetic set of PDRs, mixing state effecter, state sensor
+ *         and entity association PDRs roughly as a BMC would.
+ *
+ *  Bodies are sized as per DSP0248: state sensor/effecter PDRs with one or
+ *  two composite sensors/effecters, entity association PDRs with 1 to 8
+ *  contained entities.
+ */
+std::vector<Record> makeRecords(size_t count)
+{
+    std::mt19937 gen(count);
+    std::uniform_int_distribution<size_t> composite(1, 2);
+    std::uniform_int_distribution<size_t> children(1, 8);
+
+    std::vector<Record> records;
+    records.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        switch (i % 3)
+        {
+            case 0:
+                records.emplace_back(
+                    makePdr(PLDM_STATE_EFFECTER_PDR, 14 + 4 * composite(gen)));
+                break;
+            case 1:
+                records.emplace_back(
+                    makePdr(PLDM_STATE_SENSOR_PDR, 11 + 4 * composite(gen)));
+                break;
+            default:
+                records.emplace_back(makePdr(PLDM_PDR_ENTITY_ASSOCIATION,
+                                             10 + 6 * children(gen)));
+                break;
+        }
+    }
+    return records;
+}
+
+pldm_pdr* makeRepo(const std::vector<Record>& records)
+{
+    auto repo = pldm_pdr_init();
+    for (const auto& record : records)
+    {
+        pldm_pdr_add(repo, record.data(), record.size(), 0);
+    }
+    return repo;
+}
+
+void setRecordCounters(benchmark::State& state, size_t count)
+{
+    state.SetItemsProcessed(state.iterations() * count);
+    state.counters["records"] = count;
+}
+
+} // namespace
+
+static void BM_PdrAdd(benchmark::State& state)
+{
+    auto records = makeRecords(state.range(0));
+    for (auto _ : state)
+    {
+        auto repo = makeRepo(records);
+        benchmark::DoNotOptimize(repo);
+        state.PauseTiming();
+        pldm_pdr_destroy(repo);
+        state.ResumeTiming();
+    }
+    setRecordCounters(state, records.size());
+}
+BENCHMARK(BM_PdrAdd)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_PdrFindRecordRandom(benchmark::State& state)
+{
+    auto records = makeRecords(state.range(0));
+    auto repo = makeRepo(records);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<uint32_t> handles(1, records.size());
+    std::vector<uint32_t> lookups(1024);
+    std::generate(lookups.begin(), lookups.end(),
+                  [&]() { return handles(gen); });
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        uint8_t* data = nullptr;
+        uint32_t size{};
+        uint32_t nextRecHdl{};
+        auto record = pldm_pdr_find_record(repo, lookups[i++ % lookups.size()],
+                                           &data, &size, &nextRecHdl);
+        benchmark::DoNotOptimize(record);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["records"] = records.size();
+    pldm_pdr_destroy(repo);
+}
+BENCHMARK(BM_PdrFindRecordRandom)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_PdrGetNextRecordWalk(benchmark::State& state)
+{
+    auto records = makeRecords(state.range(0));
+    auto repo = makeRepo(records);
+
+    for (auto _ : state)
+    {
+        uint8_t* data = nullptr;
+        uint32_t size{};
+        uint32_t nextRecHdl{};
+        auto record = pldm_pdr_find_record(repo, 0, &data, &size, &nextRecHdl);
+        while (record)
+        {
+            benchmark::DoNotOptimize(data);
+            record = pldm_pdr_get_next_record(repo, record, &data, &size,
+                                              &nextRecHdl);
+        }
+    }
+    setRecordCounters(state, records.size());
+    pldm_pdr_destroy(repo);
+}
+BENCHMARK(BM_PdrGetNextRecordWalk)->RangeMultiplier(10)->Range(100, 10000);
+
+static void BM_PdrFindRecordByTypeWalk(benchmark::State& state)
+{
+    auto records = makeRecords(state.range(0));
+    auto repo = makeRepo(records);
+
+    for (auto _ : state)
+    {
+        uint8_t* data = nullptr;
+        uint32_t size{};
+        auto record = pldm_pdr_find_record_by_type(
+            repo, PLDM_STATE_SENSOR_PDR, nullptr, &data, &size);
+        while (record)
+        {
+            benchmark::DoNotOptimize(data);
+            record = pldm_pdr_find_record_by_type(repo, PLDM_STATE_SENSOR_PDR,
+                                                  record, &data, &size);
+        }
+    }
+    setRecordCounters(state, records.size());
+    pldm_pdr_destroy(repo);
+}
+BENCHMARK(BM_PdrFindRecordByTypeWalk)->RangeMultiplier(10)->Range(100, 10000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "libpldm/utils.h"
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+std::vector<uint8_t> makeData(size_t size)
+{
+    std::mt19937 gen(size);
+    std::uniform_int_distribution<unsigned> byte(0, 0xff);
+    std::vector<uint8_t> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return byte(gen); });
+    return data;
+}
+
+/** @brief The byte-at-a-time table loop crc32 used to be, as a baseline */
+uint32_t crc32Bytewise(const uint8_t* data, size_t size)
+{
+    static const auto table = []() {
+        std::vector<uint32_t> table(256);
+        for (uint32_t i = 0; i < table.size(); ++i)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ (crc & 1 ? 0xedb88320 : 0);
+            }
+            table[i] = crc;
+        }
+        return table;
+    }();
+
+    uint32_t crc = ~0U;
+    while (size--)
+    {
+        crc = table[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+} // namespace
+
+static void BM_Crc32(benchmark::State& state)
+{
+    auto data = makeData(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(crc32(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Crc32)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+static void BM_Crc32Bytewise(benchmark::State& state)
+{
+    auto data = makeData(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(crc32Bytewise(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Crc32Bytewise)->RangeMultiplier(8)->Range(16, 1 << 20);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <endian.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
@@ -53,17 +54,27 @@ size_t pldm_bios_table_string_entry_encode_length(uint16_t string_length)
 	       MEMBER_SIZE(pldm_bios_string_table_entry, name) + string_length;
 }
 
-void pldm_bios_table_string_entry_encode(void *entry, size_t entry_length,
-					 const char *str, uint16_t str_length)
+static void string_table_entry_encode(void *entry, size_t entry_length,
+				      uint16_t handle, const char *str,
+				      uint16_t str_length)
 {
 	size_t length = pldm_bios_table_string_entry_encode_length(str_length);
 	assert(length <= entry_length);
 	struct pldm_bios_string_table_entry *string_entry = entry;
-	string_entry->string_handle = htole16(get_bios_string_handle());
+	string_entry->string_handle = htole16(handle);
 	string_entry->string_length = htole16(str_length);
 	memcpy(string_entry->name, str, str_length);
 }
 
+void pldm_bios_table_string_entry_encode(void *entry, size_t entry_length,
+					 const char *str, uint16_t str_length)
+{
+	size_t length = pldm_bios_table_string_entry_encode_length(str_length);
+	assert(length <= entry_length);
+	string_table_entry_encode(entry, entry_length,
+				  get_bios_string_handle(), str, str_length);
+}
+
 int pldm_bios_table_string_entry_encode_check(void *entry, size_t entry_length,
 					      const char *str,
 					      uint16_t str_length)
@@ -130,12 +141,13 @@ static uint16_t get_bios_attr_handle()
 }
 
 static void attr_table_entry_encode_header(void *entry, size_t length,
+					   uint16_t attr_handle,
 					   uint8_t attr_type,
 					   uint16_t string_handle)
 {
 	struct pldm_bios_attr_table_entry *attr_entry = entry;
 	assert(sizeof(*attr_entry) <= length);
-	attr_entry->attr_handle = htole16(get_bios_attr_handle());
+	attr_entry->attr_handle = htole16(attr_handle);
 	attr_entry->attr_type = attr_type;
 	attr_entry->string_handle = htole16(string_handle);
 }
@@ -167,8 +179,8 @@ size_t pldm_bios_table_attr_entry_enum_encode_length(uint8_t pv_num,
 	       def_num;
 }
 
-void pldm_bios_table_attr_entry_enum_encode(
-    void *entry, size_t entry_length,
+static void attr_table_entry_enum_encode(
+    void *entry, size_t entry_length, uint16_t attr_handle,
     const struct pldm_bios_table_attr_entry_enum_info *info)
 {
 	size_t length = pldm_bios_table_attr_entry_enum_encode_length(
@@ -176,8 +188,8 @@ void pldm_bios_table_attr_entry_enum_encode(
 	assert(length <= entry_length);
 	uint8_t attr_type = info->read_only ? PLDM_BIOS_ENUMERATION_READ_ONLY
 					    : PLDM_BIOS_ENUMERATION;
-	attr_table_entry_encode_header(entry, entry_length, attr_type,
-				       info->name_handle);
+	attr_table_entry_encode_header(entry, entry_length, attr_handle,
+				       attr_type, info->name_handle);
 	struct pldm_bios_attr_table_entry *attr_entry = entry;
 	attr_entry->metadata[0] = info->pv_num;
 	uint16_t *pv_hdls =
@@ -192,6 +204,37 @@ void pldm_bios_table_attr_entry_enum_encode(
 	       info->def_index, info->def_num);
 }
 
+void pldm_bios_table_attr_entry_enum_encode(
+    void *entry, size_t entry_length,
+    const struct pldm_bios_table_attr_entry_enum_info *info)
+{
+	size_t length = pldm_bios_table_attr_entry_enum_encode_length(
+	    info->pv_num, info->def_num);
+	assert(length <= entry_length);
+	attr_table_entry_enum_encode(entry, entry_length,
+				     get_bios_attr_handle(), info);
+}
+
+int pldm_bios_table_attr_entry_enum_info_check(
+    const struct pldm_bios_table_attr_entry_enum_info *info,
+    const char **errmsg)
+{
+	if (info->def_num > info->pv_num) {
+		set_errmsg(errmsg, "NumberOfDefaultValues should not be "
+				   "greater than NumberOfPossibleValues");
+		return PLDM_ERROR_INVALID_DATA;
+	}
+	for (uint8_t i = 0; i < info->def_num; i++) {
+		if (info->def_index[i] >= info->pv_num) {
+			set_errmsg(errmsg,
+				   "Wrong DefaultValueStringHandleIndex");
+			return PLDM_ERROR_INVALID_DATA;
+		}
+	}
+
+	return PLDM_SUCCESS;
+}
+
 int pldm_bios_table_attr_entry_enum_encode_check(
     void *entry, size_t entry_length,
     const struct pldm_bios_table_attr_entry_enum_info *info)
@@ -201,6 +244,9 @@ int pldm_bios_table_attr_entry_enum_encode_check(
 	size_t length = pldm_bios_table_attr_entry_enum_encode_length(
 	    info->pv_num, info->def_num);
 	BUFFER_SIZE_EXPECT(entry_length, length);
+	if (pldm_bios_table_attr_entry_enum_info_check(info, NULL) !=
+	    PLDM_SUCCESS)
+		return PLDM_ERROR_INVALID_DATA;
 	pldm_bios_table_attr_entry_enum_encode(entry, entry_length, info);
 	return PLDM_SUCCESS;
 }
@@ -315,8 +361,8 @@ size_t pldm_bios_table_attr_entry_string_encode_length(uint16_t def_str_len)
 	       def_str_len;
 }
 
-void pldm_bios_table_attr_entry_string_encode(
-    void *entry, size_t entry_length,
+static void attr_table_entry_string_encode(
+    void *entry, size_t entry_length, uint16_t attr_handle,
     const struct pldm_bios_table_attr_entry_string_info *info)
 {
 	size_t length =
@@ -324,8 +370,8 @@ void pldm_bios_table_attr_entry_string_encode(
 	assert(length <= entry_length);
 	uint8_t attr_type =
 	    info->read_only ? PLDM_BIOS_STRING_READ_ONLY : PLDM_BIOS_STRING;
-	attr_table_entry_encode_header(entry, entry_length, attr_type,
-				       info->name_handle);
+	attr_table_entry_encode_header(entry, entry_length, attr_handle,
+				       attr_type, info->name_handle);
 	struct pldm_bios_attr_table_entry *attr_entry = entry;
 	struct attr_table_string_entry_fields *attr_fields =
 	    (struct attr_table_string_entry_fields *)attr_entry->metadata;
@@ -338,6 +384,17 @@ void pldm_bios_table_attr_entry_string_encode(
 		       info->def_length);
 }
 
+void pldm_bios_table_attr_entry_string_encode(
+    void *entry, size_t entry_length,
+    const struct pldm_bios_table_attr_entry_string_info *info)
+{
+	size_t length =
+	    pldm_bios_table_attr_entry_string_encode_length(info->def_length);
+	assert(length <= entry_length);
+	attr_table_entry_string_encode(entry, entry_length,
+				       get_bios_attr_handle(), info);
+}
+
 #define PLDM_STRING_TYPE_MAX 5
 #define PLDM_STRING_TYPE_VENDOR 0xff
 
@@ -468,16 +525,16 @@ size_t pldm_bios_table_attr_entry_integer_encode_length()
 	       sizeof(struct attr_table_integer_entry_fields);
 }
 
-void pldm_bios_table_attr_entry_integer_encode(
-    void *entry, size_t entry_length,
+static void attr_table_entry_integer_encode(
+    void *entry, size_t entry_length, uint16_t attr_handle,
     const struct pldm_bios_table_attr_entry_integer_info *info)
 {
 	size_t length = pldm_bios_table_attr_entry_integer_encode_length();
 	assert(length <= entry_length);
 	uint8_t attr_type =
 	    info->read_only ? PLDM_BIOS_INTEGER_READ_ONLY : PLDM_BIOS_INTEGER;
-	attr_table_entry_encode_header(entry, entry_length, attr_type,
-				       info->name_handle);
+	attr_table_entry_encode_header(entry, entry_length, attr_handle,
+				       attr_type, info->name_handle);
 	struct pldm_bios_attr_table_entry *attr_entry = entry;
 	struct attr_table_integer_entry_fields *attr_fields =
 	    (struct attr_table_integer_entry_fields *)attr_entry->metadata;
@@ -487,6 +544,16 @@ void pldm_bios_table_attr_entry_integer_encode(
 	attr_fields->default_value = htole64(info->default_value);
 }
 
+void pldm_bios_table_attr_entry_integer_encode(
+    void *entry, size_t entry_length,
+    const struct pldm_bios_table_attr_entry_integer_info *info)
+{
+	size_t length = pldm_bios_table_attr_entry_integer_encode_length();
+	assert(length <= entry_length);
+	attr_table_entry_integer_encode(entry, entry_length,
+					get_bios_attr_handle(), info);
+}
+
 int pldm_bios_table_attr_entry_integer_info_check(
     const struct pldm_bios_table_attr_entry_integer_info *info,
     const char **errmsg)
@@ -625,7 +692,7 @@ size_t pldm_bios_table_attr_value_entry_encode_enum_length(uint8_t count)
 
 void pldm_bios_table_attr_value_entry_encode_enum(
     void *entry, size_t entry_length, uint16_t attr_handle, uint8_t attr_type,
-    uint8_t count, uint8_t *handles)
+    uint8_t count, const uint8_t *handles)
 {
 	size_t length =
 	    pldm_bios_table_attr_value_entry_encode_enum_length(count);
@@ -659,7 +726,7 @@ uint8_t pldm_bios_table_attr_value_entry_enum_decode_handles(
 
 int pldm_bios_table_attr_value_entry_encode_enum_check(
     void *entry, size_t entry_length, uint16_t attr_handle, uint8_t attr_type,
-    uint8_t count, uint8_t *handles)
+    uint8_t count, const uint8_t *handles)
 {
 	POINTER_CHECK(entry);
 	if (count != 0 && handles == NULL)
@@ -887,23 +954,11 @@ size_t pldm_bios_table_append_pad_checksum(void *table, size_t size,
 	return total_length;
 }
 
-struct pldm_bios_table_iter {
-	const uint8_t *table_data;
-	size_t table_len;
-	size_t current_pos;
-	size_t (*entry_length_handler)(const void *table_entry);
-};
-
-struct pldm_bios_table_iter *
-pldm_bios_table_iter_create(const void *table, size_t length,
-			    enum pldm_bios_table_types type)
+int pldm_bios_table_iter_init(struct pldm_bios_table_iter *iter,
+			      const void *table, size_t length,
+			      enum pldm_bios_table_types type)
 {
-	struct pldm_bios_table_iter *iter = malloc(sizeof(*iter));
-	assert(iter != NULL);
-	iter->table_data = table;
-	iter->table_len = length;
-	iter->current_pos = 0;
-	iter->entry_length_handler = NULL;
+	POINTER_CHECK(iter);
 	switch (type) {
 	case PLDM_BIOS_STRING_TABLE:
 		iter->entry_length_handler = string_table_entry_length;
@@ -914,6 +969,27 @@ pldm_bios_table_iter_create(const void *table, size_t length,
 	case PLDM_BIOS_ATTR_VAL_TABLE:
 		iter->entry_length_handler = attr_value_table_entry_length;
 		break;
+	default:
+		return PLDM_ERROR_INVALID_DATA;
+	}
+	iter->table_data = table;
+	iter->table_len = length;
+	iter->current_pos = 0;
+
+	return PLDM_SUCCESS;
+}
+
+struct pldm_bios_table_iter *
+pldm_bios_table_iter_create(const void *table, size_t length,
+			    enum pldm_bios_table_types type)
+{
+	struct pldm_bios_table_iter *iter = malloc(sizeof(*iter));
+	if (iter == NULL)
+		return NULL;
+	if (pldm_bios_table_iter_init(iter, table, length, type) !=
+	    PLDM_SUCCESS) {
+		free(iter);
+		return NULL;
 	}
 
 	return iter;
@@ -927,7 +1003,9 @@ void pldm_bios_table_iter_free(struct pldm_bios_table_iter *iter)
 #define pad_and_check_max 7
 bool pldm_bios_table_iter_is_end(const struct pldm_bios_table_iter *iter)
 {
-	if (iter->table_len - iter->current_pos <= pad_and_check_max)
+	/* An entry claiming to run past the end of the table ends it too */
+	if (iter->current_pos >= iter->table_len ||
+	    iter->table_len - iter->current_pos <= pad_and_check_max)
 		return true;
 	return false;
 }
@@ -940,7 +1018,7 @@ void pldm_bios_table_iter_next(struct pldm_bios_table_iter *iter)
 	iter->current_pos += iter->entry_length_handler(entry);
 }
 
-const void *pldm_bios_table_iter_value(struct pldm_bios_table_iter *iter)
+const void *pldm_bios_table_iter_value(const struct pldm_bios_table_iter *iter)
 {
 	return iter->table_data + iter->current_pos;
 }
@@ -966,12 +1044,11 @@ pldm_bios_table_entry_find_from_table(const void *table, size_t length,
 				      enum pldm_bios_table_types type,
 				      equal_handler equal, const void *key)
 {
-	struct pldm_bios_table_iter *iter =
-	    pldm_bios_table_iter_create(table, length, type);
-	const void *entry =
-	    pldm_bios_table_entry_find_by_iter(iter, key, equal);
-	pldm_bios_table_iter_free(iter);
-	return entry;
+	struct pldm_bios_table_iter iter;
+	if (pldm_bios_table_iter_init(&iter, table, length, type) !=
+	    PLDM_SUCCESS)
+		return NULL;
+	return pldm_bios_table_entry_find_by_iter(&iter, key, equal);
 }
 
 static bool string_table_handle_equal(const void *entry, const void *key)
@@ -1051,54 +1128,876 @@ pldm_bios_table_attr_value_find_by_handle(const void *table, size_t length,
 	    attr_value_table_handle_equal, &handle);
 }
 
+void pldm_bios_table_builder_init(struct pldm_bios_table_builder *builder,
+				  void *table, size_t size)
+{
+	builder->table = table;
+	builder->size = table != NULL ? size : 0;
+	builder->length = 0;
+	builder->next_handle = 0;
+	builder->rc = PLDM_SUCCESS;
+	builder->errmsg = NULL;
+}
+
+void pldm_bios_table_builder_set_buffer(
+    struct pldm_bios_table_builder *builder, void *table, size_t size)
+{
+	assert(size >= builder->length);
+	/* A builder sizing the table has no entries to move */
+	assert(builder->table != NULL || builder->length == 0);
+	builder->table = table;
+	builder->size = table != NULL ? size : 0;
+}
+
+static int builder_fail(struct pldm_bios_table_builder *builder, int rc,
+			const char *errmsg)
+{
+	if (builder->rc == PLDM_SUCCESS) {
+		builder->rc = rc;
+		builder->errmsg = errmsg;
+	}
+	return rc;
+}
+
+/* Reserve an entry and a handle for it, *entry is left NULL if the builder
+ * only sizes the table */
+static int builder_reserve(struct pldm_bios_table_builder *builder,
+			   size_t entry_length, void **entry)
+{
+	*entry = NULL;
+	if (builder->rc != PLDM_SUCCESS)
+		return builder->rc;
+	if (builder->next_handle == UINT16_MAX)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA,
+				    "Out of BIOS table handles");
+	if (builder->table == NULL)
+		return PLDM_SUCCESS;
+	if (entry_length > builder->size - builder->length)
+		return builder_fail(builder, PLDM_ERROR_INVALID_LENGTH,
+				    "BIOS table buffer too small");
+	*entry = builder->table + builder->length;
+	return PLDM_SUCCESS;
+}
+
+static void builder_commit(struct pldm_bios_table_builder *builder,
+			   size_t entry_length, uint16_t *handle)
+{
+	builder->length += entry_length;
+	if (handle != NULL)
+		*handle = builder->next_handle;
+	builder->next_handle++;
+}
+
+int pldm_bios_table_builder_string_add(
+    struct pldm_bios_table_builder *builder, const char *str,
+    uint16_t str_length, uint16_t *handle)
+{
+	POINTER_CHECK(builder);
+	if (str == NULL || str_length == 0)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA,
+				    "Empty BIOS string");
+	size_t length = pldm_bios_table_string_entry_encode_length(str_length);
+	void *entry;
+	int rc = builder_reserve(builder, length, &entry);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	if (entry != NULL)
+		string_table_entry_encode(entry, length, builder->next_handle,
+					  str, str_length);
+	builder_commit(builder, length, handle);
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_builder_attr_enum_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_enum_info *info, uint16_t *handle)
+{
+	POINTER_CHECK(builder);
+	if (info == NULL)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA,
+				    "No BIOS attribute info");
+	const char *errmsg = NULL;
+	if (pldm_bios_table_attr_entry_enum_info_check(info, &errmsg) !=
+	    PLDM_SUCCESS)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA, errmsg);
+	size_t length = pldm_bios_table_attr_entry_enum_encode_length(
+	    info->pv_num, info->def_num);
+	void *entry;
+	int rc = builder_reserve(builder, length, &entry);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	if (entry != NULL)
+		attr_table_entry_enum_encode(entry, length,
+					     builder->next_handle, info);
+	builder_commit(builder, length, handle);
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_builder_attr_string_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_string_info *info,
+    uint16_t *handle)
+{
+	POINTER_CHECK(builder);
+	if (info == NULL)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA,
+				    "No BIOS attribute info");
+	const char *errmsg = NULL;
+	if (pldm_bios_table_attr_entry_string_info_check(info, &errmsg) !=
+	    PLDM_SUCCESS)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA, errmsg);
+	size_t length =
+	    pldm_bios_table_attr_entry_string_encode_length(info->def_length);
+	void *entry;
+	int rc = builder_reserve(builder, length, &entry);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	if (entry != NULL)
+		attr_table_entry_string_encode(entry, length,
+					       builder->next_handle, info);
+	builder_commit(builder, length, handle);
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_builder_attr_integer_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_integer_info *info,
+    uint16_t *handle)
+{
+	POINTER_CHECK(builder);
+	if (info == NULL)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA,
+				    "No BIOS attribute info");
+	const char *errmsg = NULL;
+	if (pldm_bios_table_attr_entry_integer_info_check(info, &errmsg) !=
+	    PLDM_SUCCESS)
+		return builder_fail(builder, PLDM_ERROR_INVALID_DATA, errmsg);
+	size_t length = pldm_bios_table_attr_entry_integer_encode_length();
+	void *entry;
+	int rc = builder_reserve(builder, length, &entry);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	if (entry != NULL)
+		attr_table_entry_integer_encode(entry, length,
+						builder->next_handle, info);
+	builder_commit(builder, length, handle);
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_builder_finish(struct pldm_bios_table_builder *builder,
+				   size_t *length)
+{
+	POINTER_CHECK(builder);
+	POINTER_CHECK(length);
+	if (builder->rc != PLDM_SUCCESS)
+		return builder->rc;
+	size_t pad_checksum_size =
+	    pldm_bios_table_pad_checksum_size(builder->length);
+	if (builder->table == NULL) {
+		*length = builder->length + pad_checksum_size;
+		return PLDM_SUCCESS;
+	}
+	if (pad_checksum_size > builder->size - builder->length)
+		return builder_fail(builder, PLDM_ERROR_INVALID_LENGTH,
+				    "BIOS table buffer too small");
+	*length = pldm_bios_table_append_pad_checksum(
+	    builder->table, builder->size, builder->length);
+	return PLDM_SUCCESS;
+}
+
+#define INDEX_NO_ENTRY UINT32_MAX
+
+struct pldm_bios_table_index {
+	enum pldm_bios_table_types type;
+	size_t table_len;
+	/* length of the entries, without pad and checksum */
+	size_t entries_len;
+	size_t offsets_len;
+	uint32_t *offsets;
+	/* string tables only, offsets of the entries ordered by string */
+	size_t sorted_len;
+	uint32_t *sorted;
+};
+
+static uint16_t table_entry_decode_handle(const void *entry,
+					  enum pldm_bios_table_types type)
+{
+	switch (type) {
+	case PLDM_BIOS_STRING_TABLE:
+		return pldm_bios_table_string_entry_decode_handle(entry);
+	case PLDM_BIOS_ATTR_TABLE:
+		return pldm_bios_table_attr_entry_decode_attribute_handle(
+		    entry);
+	case PLDM_BIOS_ATTR_VAL_TABLE:
+		return pldm_bios_table_attr_value_entry_decode_handle(entry);
+	}
+	assert(0);
+	return 0;
+}
+
+static int string_compare(const void *str1, uint16_t str1_length,
+			  const void *str2, uint16_t str2_length)
+{
+	uint16_t length =
+	    str1_length < str2_length ? str1_length : str2_length;
+	int rc = memcmp(str1, str2, length);
+	if (rc != 0)
+		return rc;
+	return (int)str1_length - (int)str2_length;
+}
+
+static int string_entry_compare(const struct pldm_bios_string_table_entry *e1,
+				const struct pldm_bios_string_table_entry *e2)
+{
+	return string_compare(
+	    e1->name, pldm_bios_table_string_entry_decode_string_length(e1),
+	    e2->name, pldm_bios_table_string_entry_decode_string_length(e2));
+}
+
+/* Order by string, then by position in the table so that the first of
+ * duplicated strings is found, as a linear search would */
+static int string_entry_ptr_compare(const void *p1, const void *p2)
+{
+	const struct pldm_bios_string_table_entry *e1 =
+	    *(const struct pldm_bios_string_table_entry *const *)p1;
+	const struct pldm_bios_string_table_entry *e2 =
+	    *(const struct pldm_bios_string_table_entry *const *)p2;
+	int rc = string_entry_compare(e1, e2);
+	if (rc != 0)
+		return rc;
+	return (e1 > e2) - (e1 < e2);
+}
+
+/* Tables built in sorted order, as the responder does, need no sorting */
+static int index_sort_strings(struct pldm_bios_table_index *index,
+			      const uint8_t *table)
+{
+	bool sorted = true;
+	for (size_t i = 1; i < index->sorted_len && sorted; i++)
+		sorted = string_entry_compare(
+			     (const void *)(table + index->sorted[i - 1]),
+			     (const void *)(table + index->sorted[i])) <= 0;
+	if (sorted)
+		return 0;
+
+	const struct pldm_bios_string_table_entry **entries =
+	    malloc(index->sorted_len * sizeof(*entries));
+	if (entries == NULL)
+		return -1;
+	for (size_t i = 0; i < index->sorted_len; i++)
+		entries[i] = (const void *)(table + index->sorted[i]);
+	qsort(entries, index->sorted_len, sizeof(*entries),
+	      string_entry_ptr_compare);
+	for (size_t i = 0; i < index->sorted_len; i++)
+		index->sorted[i] = (const uint8_t *)entries[i] - table;
+	free(entries);
+	return 0;
+}
+
+static int index_reserve(struct pldm_bios_table_index *index, uint16_t handle)
+{
+	if (handle < index->offsets_len)
+		return 0;
+
+	size_t len = index->offsets_len ? index->offsets_len : 16;
+	while (len <= handle)
+		len *= 2;
+	if (len > (size_t)UINT16_MAX + 1)
+		len = (size_t)UINT16_MAX + 1;
+
+	uint32_t *offsets = realloc(index->offsets, len * sizeof(*offsets));
+	if (offsets == NULL)
+		return -1;
+	for (size_t i = index->offsets_len; i < len; i++)
+		offsets[i] = INDEX_NO_ENTRY;
+	index->offsets = offsets;
+	index->offsets_len = len;
+	return 0;
+}
+
+struct pldm_bios_table_index *
+pldm_bios_table_index_create(const void *table, size_t length,
+			     enum pldm_bios_table_types type)
+{
+	if (table == NULL || length > INDEX_NO_ENTRY)
+		return NULL;
+
+	struct pldm_bios_table_index *index = malloc(sizeof(*index));
+	if (index == NULL)
+		return NULL;
+	index->type = type;
+	index->table_len = length;
+	index->entries_len = 0;
+	index->offsets_len = 0;
+	index->offsets = NULL;
+	index->sorted_len = 0;
+	index->sorted = NULL;
+
+	/* Every entry takes at least 4 bytes, whatever the table type */
+	if (type == PLDM_BIOS_STRING_TABLE && length >= 4) {
+		index->sorted = malloc(length / 4 * sizeof(*index->sorted));
+		if (index->sorted == NULL)
+			goto err;
+	}
+
+	struct pldm_bios_table_iter iter;
+	if (pldm_bios_table_iter_init(&iter, table, length, type) !=
+	    PLDM_SUCCESS)
+		goto err;
+	while (!pldm_bios_table_iter_is_end(&iter)) {
+		const void *entry = pldm_bios_table_iter_value(&iter);
+		size_t entry_length = iter.entry_length_handler(entry);
+		/* Don't index an entry overrunning a truncated table */
+		if (entry_length > length - iter.current_pos)
+			break;
+
+		uint16_t handle = table_entry_decode_handle(entry, type);
+		if (index_reserve(index, handle) != 0)
+			goto err;
+		/* Keep the first entry of a duplicated handle, as a linear
+		 * search would */
+		if (index->offsets[handle] == INDEX_NO_ENTRY)
+			index->offsets[handle] = iter.current_pos;
+		if (index->sorted != NULL)
+			index->sorted[index->sorted_len++] = iter.current_pos;
+		iter.current_pos += entry_length;
+	}
+	index->entries_len = iter.current_pos;
+
+	if (index->sorted != NULL && index_sort_strings(index, table) != 0)
+		goto err;
+
+	return index;
+err:
+	pldm_bios_table_index_free(index);
+	return NULL;
+}
+
+void pldm_bios_table_index_free(struct pldm_bios_table_index *index)
+{
+	if (index == NULL)
+		return;
+	free(index->offsets);
+	free(index->sorted);
+	free(index);
+}
+
+static const void *
+pldm_bios_table_index_find(const void *table, size_t length,
+			   const struct pldm_bios_table_index *index,
+			   enum pldm_bios_table_types type, uint16_t handle)
+{
+	if (table == NULL || index == NULL || index->type != type ||
+	    index->table_len != length)
+		return NULL;
+	if (handle >= index->offsets_len ||
+	    index->offsets[handle] == INDEX_NO_ENTRY)
+		return NULL;
+
+	return (const uint8_t *)table + index->offsets[handle];
+}
+
+const struct pldm_bios_string_table_entry *
+pldm_bios_table_string_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle)
+{
+	return pldm_bios_table_index_find(table, length, index,
+					  PLDM_BIOS_STRING_TABLE, handle);
+}
+
+const struct pldm_bios_string_table_entry *
+pldm_bios_table_string_find_by_string_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, const char *str)
+{
+	if (table == NULL || index == NULL || str == NULL ||
+	    index->type != PLDM_BIOS_STRING_TABLE ||
+	    index->table_len != length)
+		return NULL;
+
+	size_t str_length = strlen(str);
+	if (str_length > UINT16_MAX)
+		return NULL;
+
+	/* Find the first entry not ordered before str */
+	size_t lo = 0, hi = index->sorted_len;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		const struct pldm_bios_string_table_entry *entry =
+		    (const void *)((const uint8_t *)table + index->sorted[mid]);
+		uint16_t entry_str_length =
+		    pldm_bios_table_string_entry_decode_string_length(entry);
+		if (string_compare(entry->name, entry_str_length, str,
+				   str_length) < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == index->sorted_len)
+		return NULL;
+
+	const struct pldm_bios_string_table_entry *entry =
+	    (const void *)((const uint8_t *)table + index->sorted[lo]);
+	if (pldm_bios_table_string_entry_decode_string_length(entry) !=
+		str_length ||
+	    memcmp(entry->name, str, str_length) != 0)
+		return NULL;
+	return entry;
+}
+
+const struct pldm_bios_attr_table_entry *
+pldm_bios_table_attr_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle)
+{
+	return pldm_bios_table_index_find(table, length, index,
+					  PLDM_BIOS_ATTR_TABLE, handle);
+}
+
+const struct pldm_bios_attr_val_table_entry *
+pldm_bios_table_attr_value_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle)
+{
+	return pldm_bios_table_index_find(table, length, index,
+					  PLDM_BIOS_ATTR_VAL_TABLE, handle);
+}
+
 int pldm_bios_table_attr_value_copy_and_update(
     const void *src_table, size_t src_length, void *dest_table,
     size_t *dest_length, const void *entry, size_t entry_length)
 {
-	struct pldm_bios_table_iter *iter = pldm_bios_table_iter_create(
-	    src_table, src_length, PLDM_BIOS_ATTR_VAL_TABLE);
+	struct pldm_bios_table_iter iter;
+	int rc = pldm_bios_table_iter_init(&iter, src_table, src_length,
+					   PLDM_BIOS_ATTR_VAL_TABLE);
+	if (rc != PLDM_SUCCESS)
+		return rc;
 
-	int rc = PLDM_SUCCESS;
 	const struct pldm_bios_attr_val_table_entry *tmp, *to_update = entry;
 	size_t buffer_length = *dest_length, copied_length = 0, length = 0;
-	while (!pldm_bios_table_iter_is_end(iter)) {
-		tmp = pldm_bios_table_iter_attr_value_entry_value(iter);
+	while (!pldm_bios_table_iter_is_end(&iter)) {
+		tmp = pldm_bios_table_iter_attr_value_entry_value(&iter);
 		length = attr_value_table_entry_length(tmp);
 
 		/* we need the tmp's entry_length here, iter_next will calculate
 		 * it too, use current_pos directly to avoid calculating it
 		 * twice */
-		iter->current_pos += length;
+		iter.current_pos += length;
 		if (tmp->attr_handle == to_update->attr_handle) {
-			if (tmp->attr_type != to_update->attr_type) {
-				rc = PLDM_ERROR_INVALID_DATA;
-				goto out;
-			}
-			if (attribute_is_readonly(tmp->attr_type)) {
-				rc = PLDM_ERROR_INVALID_DATA;
-				goto out;
-			}
+			if (tmp->attr_type != to_update->attr_type ||
+			    attribute_is_readonly(tmp->attr_type))
+				return PLDM_ERROR_INVALID_DATA;
 			length = entry_length;
 			tmp = entry;
 		}
-		if (copied_length + length > buffer_length) {
-			rc = PLDM_ERROR_INVALID_LENGTH;
-			goto out;
-		}
+		if (copied_length + length > buffer_length)
+			return PLDM_ERROR_INVALID_LENGTH;
 		memcpy((uint8_t *)dest_table + copied_length, tmp, length);
 		copied_length += length;
 	}
 
 	size_t pad_checksum_size =
 	    pldm_bios_table_pad_checksum_size(copied_length);
-	if ((pad_checksum_size + copied_length) > buffer_length) {
-		rc = PLDM_ERROR_INVALID_LENGTH;
-		goto out;
-	}
+	if ((pad_checksum_size + copied_length) > buffer_length)
+		return PLDM_ERROR_INVALID_LENGTH;
 
 	*dest_length = pldm_bios_table_append_pad_checksum(
 	    dest_table, buffer_length, copied_length);
-out:
-	pldm_bios_table_iter_free(iter);
-	return rc;
+	return PLDM_SUCCESS;
+}
+
+static uint32_t table_checksum_get(const uint8_t *table, size_t length)
+{
+	uint32_t checksum;
+	memcpy(&checksum, table + length - sizeof(checksum), sizeof(checksum));
+	return le32toh(checksum);
+}
+
+/* Replace the entry of old_length bytes at offset, entries_end being the end
+ * of the entries; entries_end is only used when the size of the entry
+ * changes */
+static int attr_value_update_at(uint8_t *data, size_t *length, size_t size,
+				size_t offset, size_t old_length,
+				size_t entries_end, const void *entry,
+				size_t entry_length)
+{
+	size_t checksum_offset = *length - sizeof(uint32_t);
+	uint32_t checksum = table_checksum_get(data, *length);
+	if (old_length == entry_length) {
+		/* Patch the entry and its checksum, the rest of the table is
+		 * left untouched */
+		checksum = crc32_patch(checksum, data + offset, entry,
+				       entry_length,
+				       checksum_offset - offset - entry_length);
+		memcpy(data + offset, entry, entry_length);
+		checksum_append(data + checksum_offset, checksum);
+		return PLDM_SUCCESS;
+	}
+
+	if (entries_end > checksum_offset)
+		return PLDM_ERROR_INVALID_DATA;
+	size_t new_entries_end = entries_end - old_length + entry_length;
+	size_t new_length = new_entries_end +
+			    pldm_bios_table_pad_checksum_size(new_entries_end);
+	if (new_length > size)
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	/* Recover the checksum of the entries before the one updated, then
+	 * shift the tail of the table and checksum the moved part only */
+	uint32_t prefix_checksum = crc32_prefix(
+	    checksum, crc32(data + offset, checksum_offset - offset),
+	    checksum_offset - offset);
+	memmove(data + offset + entry_length, data + offset + old_length,
+		entries_end - offset - old_length);
+	memcpy(data + offset, entry, entry_length);
+	uint8_t *table_end =
+	    pad_append(data + new_entries_end, pad_size_get(new_entries_end));
+	size_t moved_length = table_end - (data + offset);
+	checksum = crc32_combine(prefix_checksum,
+				 crc32(data + offset, moved_length),
+				 moved_length);
+	checksum_append(table_end, checksum);
+	*length = new_length;
+
+	return PLDM_SUCCESS;
+}
+
+/* Get the length of the entry at the start of a table, reading only the
+ * bytes available */
+static enum pldm_bios_table_defect
+entry_length_check(const void *entry, size_t avail,
+		   enum pldm_bios_table_types type, size_t *length)
+{
+	const struct pldm_bios_attr_table_entry *attr = entry;
+	const struct pldm_bios_attr_val_table_entry *attr_value = entry;
+	size_t needed = 0;
+
+	switch (type) {
+	case PLDM_BIOS_STRING_TABLE:
+		needed = offsetof(struct pldm_bios_string_table_entry, name);
+		break;
+	case PLDM_BIOS_ATTR_TABLE:
+		needed = offsetof(struct pldm_bios_attr_table_entry, metadata);
+		if (avail < needed)
+			return PLDM_BIOS_TABLE_TRUNCATED;
+		switch (attr->attr_type) {
+		case PLDM_BIOS_ENUMERATION:
+		case PLDM_BIOS_ENUMERATION_READ_ONLY:
+			/* Number of possible values, then the number of
+			 * default values after the possible values */
+			if (avail < needed + 1)
+				return PLDM_BIOS_TABLE_TRUNCATED;
+			needed += 1 + attr->metadata[0] * sizeof(uint16_t) + 1;
+			break;
+		case PLDM_BIOS_STRING:
+		case PLDM_BIOS_STRING_READ_ONLY:
+			needed += offsetof(
+			    struct attr_table_string_entry_fields, def_string);
+			break;
+		case PLDM_BIOS_INTEGER:
+		case PLDM_BIOS_INTEGER_READ_ONLY:
+			break;
+		default:
+			return PLDM_BIOS_TABLE_UNKNOWN_ATTR_TYPE;
+		}
+		break;
+	case PLDM_BIOS_ATTR_VAL_TABLE:
+		needed = offsetof(struct pldm_bios_attr_val_table_entry, value);
+		if (avail < needed)
+			return PLDM_BIOS_TABLE_TRUNCATED;
+		switch (attr_value->attr_type) {
+		case PLDM_BIOS_ENUMERATION:
+		case PLDM_BIOS_ENUMERATION_READ_ONLY:
+			needed += sizeof(uint8_t);
+			break;
+		case PLDM_BIOS_STRING:
+		case PLDM_BIOS_STRING_READ_ONLY:
+			needed += sizeof(uint16_t);
+			break;
+		case PLDM_BIOS_INTEGER:
+		case PLDM_BIOS_INTEGER_READ_ONLY:
+			break;
+		default:
+			return PLDM_BIOS_TABLE_UNKNOWN_ATTR_TYPE;
+		}
+		break;
+	}
+	if (avail < needed)
+		return PLDM_BIOS_TABLE_TRUNCATED;
+
+	switch (type) {
+	case PLDM_BIOS_STRING_TABLE:
+		*length = string_table_entry_length(entry);
+		break;
+	case PLDM_BIOS_ATTR_TABLE:
+		*length = attr_table_entry_length(entry);
+		break;
+	case PLDM_BIOS_ATTR_VAL_TABLE:
+		*length = attr_value_table_entry_length(entry);
+		break;
+	}
+	if (*length > avail)
+		return PLDM_BIOS_TABLE_TRUNCATED;
+	return PLDM_BIOS_TABLE_NO_DEFECT;
+}
+
+static int attr_value_update_check(void *table, size_t *length, size_t size,
+				   const void *entry, size_t entry_length)
+{
+	POINTER_CHECK(table);
+	POINTER_CHECK(length);
+	POINTER_CHECK(entry);
+	if (*length > size || *length < pldm_bios_table_pad_checksum_size(0))
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	/* The entry comes from the host, its type and lengths are read only
+	 * as far as they are known to be valid */
+	size_t to_update_length = 0;
+	switch (entry_length_check(entry, entry_length,
+				   PLDM_BIOS_ATTR_VAL_TABLE,
+				   &to_update_length)) {
+	case PLDM_BIOS_TABLE_NO_DEFECT:
+		break;
+	case PLDM_BIOS_TABLE_UNKNOWN_ATTR_TYPE:
+		return PLDM_ERROR_INVALID_DATA;
+	default:
+		return PLDM_ERROR_INVALID_LENGTH;
+	}
+	if (to_update_length != entry_length)
+		return PLDM_ERROR_INVALID_LENGTH;
+
+	return PLDM_SUCCESS;
+}
+
+int pldm_bios_table_attr_value_update_in_place(void *table, size_t *length,
+					       size_t size, const void *entry,
+					       size_t entry_length)
+{
+	int rc = attr_value_update_check(table, length, size, entry,
+					 entry_length);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	const struct pldm_bios_attr_val_table_entry *to_update = entry;
+
+	/* Find the entry to update, and the end of the entries when the size
+	 * of the entry changes */
+	struct pldm_bios_table_iter iter;
+	rc = pldm_bios_table_iter_init(&iter, table, *length,
+				       PLDM_BIOS_ATTR_VAL_TABLE);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	size_t offset = 0, old_length = 0;
+	bool found = false;
+	while (!pldm_bios_table_iter_is_end(&iter)) {
+		const struct pldm_bios_attr_val_table_entry *tmp =
+		    pldm_bios_table_iter_attr_value_entry_value(&iter);
+		size_t tmp_length = attr_value_table_entry_length(tmp);
+		if (!found && tmp->attr_handle == to_update->attr_handle) {
+			found = true;
+			offset = iter.current_pos;
+			old_length = tmp_length;
+			if (tmp->attr_type != to_update->attr_type ||
+			    attribute_is_readonly(tmp->attr_type))
+				return PLDM_ERROR_INVALID_DATA;
+			if (old_length == entry_length)
+				break;
+		}
+		iter.current_pos += tmp_length;
+	}
+	if (!found || offset + old_length > *length - sizeof(uint32_t))
+		return PLDM_ERROR_INVALID_DATA;
+
+	return attr_value_update_at(table, length, size, offset, old_length,
+				    iter.current_pos, entry, entry_length);
+}
+
+int pldm_bios_table_attr_value_update_in_place_index(
+    void *table, size_t *length, size_t size,
+    struct pldm_bios_table_index *index, const void *entry,
+    size_t entry_length)
+{
+	int rc = attr_value_update_check(table, length, size, entry,
+					 entry_length);
+	if (rc != PLDM_SUCCESS)
+		return rc;
+	POINTER_CHECK(index);
+	const struct pldm_bios_attr_val_table_entry *to_update = entry;
+
+	const struct pldm_bios_attr_val_table_entry *tmp =
+	    pldm_bios_table_attr_value_find_by_handle_index(
+		table, *length, index, to_update->attr_handle);
+	if (tmp == NULL)
+		return PLDM_ERROR_INVALID_DATA;
+	size_t offset = (const uint8_t *)tmp - (const uint8_t *)table;
+	size_t old_length = attr_value_table_entry_length(tmp);
+	if (tmp->attr_type != to_update->attr_type ||
+	    attribute_is_readonly(tmp->attr_type))
+		return PLDM_ERROR_INVALID_DATA;
+	if (offset + old_length > index->entries_len)
+		return PLDM_ERROR_INVALID_DATA;
+
+	rc = attr_value_update_at(table, length, size, offset, old_length,
+				  index->entries_len, entry, entry_length);
+	if (rc != PLDM_SUCCESS || old_length == entry_length)
+		return rc;
+
+	/* The entries after the one updated moved */
+	for (size_t i = 0; i < index->offsets_len; i++) {
+		if (index->offsets[i] != INDEX_NO_ENTRY &&
+		    index->offsets[i] > offset)
+			index->offsets[i] =
+			    index->offsets[i] - old_length + entry_length;
+	}
+	index->entries_len = index->entries_len - old_length + entry_length;
+	index->table_len = *length;
+
+	return PLDM_SUCCESS;
+}
+
+/* Check the handles an entry refers to in the reference table, *handle is
+ * set to the dangling one */
+static enum pldm_bios_table_defect
+entry_references_check(const void *entry, enum pldm_bios_table_types type,
+		       const void *ref_table, size_t ref_length,
+		       const struct pldm_bios_table_index *ref_index,
+		       uint16_t *handle)
+{
+	if (type == PLDM_BIOS_ATTR_VAL_TABLE) {
+		const struct pldm_bios_attr_val_table_entry *attr_value = entry;
+		const struct pldm_bios_attr_table_entry *attr =
+		    pldm_bios_table_attr_find_by_handle_index(
+			ref_table, ref_length, ref_index, *handle);
+		if (attr == NULL)
+			return PLDM_BIOS_TABLE_DANGLING_HANDLE;
+		if (attr->attr_type != attr_value->attr_type)
+			return PLDM_BIOS_TABLE_ATTR_TYPE_MISMATCH;
+		return PLDM_BIOS_TABLE_NO_DEFECT;
+	}
+
+	const struct pldm_bios_attr_table_entry *attr = entry;
+	uint16_t name_handle =
+	    pldm_bios_table_attr_entry_decode_string_handle(attr);
+	if (pldm_bios_table_string_find_by_handle_index(
+		ref_table, ref_length, ref_index, name_handle) == NULL) {
+		*handle = name_handle;
+		return PLDM_BIOS_TABLE_DANGLING_HANDLE;
+	}
+	if (attr->attr_type != PLDM_BIOS_ENUMERATION &&
+	    attr->attr_type != PLDM_BIOS_ENUMERATION_READ_ONLY)
+		return PLDM_BIOS_TABLE_NO_DEFECT;
+
+	uint8_t pv_num = pldm_bios_table_attr_entry_enum_decode_pv_num(attr);
+	const uint8_t *pv_hdls = attr->metadata + sizeof(pv_num);
+	for (uint8_t i = 0; i < pv_num; i++) {
+		uint16_t pv_hdl;
+		memcpy(&pv_hdl, pv_hdls + i * sizeof(pv_hdl), sizeof(pv_hdl));
+		pv_hdl = le16toh(pv_hdl);
+		if (pldm_bios_table_string_find_by_handle_index(
+			ref_table, ref_length, ref_index, pv_hdl) == NULL) {
+			*handle = pv_hdl;
+			return PLDM_BIOS_TABLE_DANGLING_HANDLE;
+		}
+	}
+	return PLDM_BIOS_TABLE_NO_DEFECT;
+}
+
+/* Check the pad and the checksum after the entries */
+static enum pldm_bios_table_defect
+table_tail_check(const uint8_t *table, size_t length, size_t *offset,
+		 uint32_t crc)
+{
+	size_t entries_length = *offset;
+	if (length - entries_length < sizeof(uint32_t))
+		return PLDM_BIOS_TABLE_TRUNCATED;
+	size_t pad_size = pad_size_get(entries_length);
+	if (length - entries_length != pad_size + sizeof(uint32_t))
+		return PLDM_BIOS_TABLE_BAD_PAD;
+	for (size_t i = 0; i < pad_size; i++) {
+		if (table[entries_length + i] != 0) {
+			*offset = entries_length + i;
+			return PLDM_BIOS_TABLE_BAD_PAD;
+		}
+	}
+	crc = crc32_update(crc, table + entries_length, pad_size);
+	if (crc != table_checksum_get(table, length)) {
+		*offset = length - sizeof(uint32_t);
+		return PLDM_BIOS_TABLE_BAD_CHECKSUM;
+	}
+	return PLDM_BIOS_TABLE_NO_DEFECT;
+}
+
+int pldm_bios_table_validate(const void *table, size_t length,
+			     enum pldm_bios_table_types type,
+			     const void *ref_table, size_t ref_length,
+			     struct pldm_bios_table_validation *report)
+{
+	POINTER_CHECK(table);
+	if (type != PLDM_BIOS_STRING_TABLE && type != PLDM_BIOS_ATTR_TABLE &&
+	    type != PLDM_BIOS_ATTR_VAL_TABLE)
+		return PLDM_ERROR_INVALID_DATA;
+
+	struct pldm_bios_table_index *ref_index = NULL;
+	if (ref_table != NULL && type != PLDM_BIOS_STRING_TABLE) {
+		ref_index = pldm_bios_table_index_create(
+		    ref_table, ref_length,
+		    type == PLDM_BIOS_ATTR_TABLE ? PLDM_BIOS_STRING_TABLE
+						 : PLDM_BIOS_ATTR_TABLE);
+		if (ref_index == NULL)
+			return PLDM_ERROR;
+	}
+	/* One bit per possible handle */
+	uint8_t *seen = calloc((UINT16_MAX + 1) / 8, 1);
+	if (seen == NULL) {
+		pldm_bios_table_index_free(ref_index);
+		return PLDM_ERROR;
+	}
+
+	struct pldm_bios_table_validation result = {
+	    PLDM_BIOS_TABLE_NO_DEFECT, 0, 0, 0};
+	const uint8_t *data = table;
+	uint32_t crc = 0;
+	/* The entries stop where only the pad and the checksum can be left,
+	 * as for the iterators */
+	while (length - result.offset > pad_and_check_max) {
+		const void *entry = data + result.offset;
+		size_t entry_length = 0;
+		result.defect = entry_length_check(
+		    entry, length - result.offset - sizeof(uint32_t), type,
+		    &entry_length);
+		if (result.defect != PLDM_BIOS_TABLE_NO_DEFECT)
+			break;
+
+		result.handle = table_entry_decode_handle(entry, type);
+		if (seen[result.handle / 8] & (1 << (result.handle % 8))) {
+			result.defect = PLDM_BIOS_TABLE_DUPLICATE_HANDLE;
+			break;
+		}
+		seen[result.handle / 8] |= 1 << (result.handle % 8);
+
+		if (ref_index != NULL) {
+			result.defect = entry_references_check(
+			    entry, type, ref_table, ref_length, ref_index,
+			    &result.handle);
+			if (result.defect != PLDM_BIOS_TABLE_NO_DEFECT)
+				break;
+		}
+
+		crc = crc32_update(crc, entry, entry_length);
+		result.offset += entry_length;
+		result.entries++;
+	}
+	if (result.defect == PLDM_BIOS_TABLE_NO_DEFECT) {
+		result.handle = 0;
+		result.defect =
+		    table_tail_check(data, length, &result.offset, crc);
+	}
+
+	free(seen);
+	pldm_bios_table_index_free(ref_index);
+	if (report != NULL)
+		*report = result;
+	return result.defect == PLDM_BIOS_TABLE_NO_DEFECT
+		   ? PLDM_SUCCESS
+		   : PLDM_ERROR_INVALID_DATA;
 }
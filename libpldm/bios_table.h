@@ -13,14 +13,34 @@ extern "C" {
 
 /** @struct pldm_bios_table_iter
  *  structure representing bios table iterator
+ *
+ *  The structure is public so that an iterator can be declared on the stack
+ *  and set up with pldm_bios_table_iter_init(), its members are private.
+ */
+struct pldm_bios_table_iter {
+	const uint8_t *table_data;
+	size_t table_len;
+	size_t current_pos;
+	size_t (*entry_length_handler)(const void *table_entry);
+};
+
+/** @brief Initialize a bios table iterator to the beginning of a table
+ *  @param[out] iter - Pointer to the bios table iterator
+ *  @param[in] table - Pointer to table data
+ *  @param[in] length - Length of table data
+ *  @param[in] type - Type of pldm bios table
+ *  @return pldm_completion_codes
  */
-struct pldm_bios_table_iter;
+int pldm_bios_table_iter_init(struct pldm_bios_table_iter *iter,
+			      const void *table, size_t length,
+			      enum pldm_bios_table_types type);
 
 /** @brief Create a bios table iterator
  *  @param[in] table - Pointer to table data
  *  @param[in] length - Length of table data
  *  @param[in] type - Type of pldm bios table
- *  @return Iterator to the beginning
+ *  @return Iterator to the beginning, NULL if the type is invalid or the
+ *          iterator can't be allocated
  */
 struct pldm_bios_table_iter *
 pldm_bios_table_iter_create(const void *table, size_t length,
@@ -47,14 +67,14 @@ void pldm_bios_table_iter_next(struct pldm_bios_table_iter *iter);
  *  @param[in] iter - Pointer to the bios table iterator
  *  @return Pointer to an entry in bios table
  */
-const void *pldm_bios_table_iter_value(struct pldm_bios_table_iter *iter);
+const void *pldm_bios_table_iter_value(const struct pldm_bios_table_iter *iter);
 
 /** @brief Get the bios attribute table entry that the iterator points to
  *  @param[in] iter - Pointer the bios attribute table iterator
  *  @return Pointer to an entry in bios attribute table
  */
 static inline const struct pldm_bios_attr_table_entry *
-pldm_bios_table_iter_attr_entry_value(struct pldm_bios_table_iter *iter)
+pldm_bios_table_iter_attr_entry_value(const struct pldm_bios_table_iter *iter)
 {
 	return (const struct pldm_bios_attr_table_entry *)
 	    pldm_bios_table_iter_value(iter);
@@ -65,7 +85,7 @@ pldm_bios_table_iter_attr_entry_value(struct pldm_bios_table_iter *iter)
  *  @return Pointer to an entry in bios string table
  */
 static inline const struct pldm_bios_string_table_entry *
-pldm_bios_table_iter_string_entry_value(struct pldm_bios_table_iter *iter)
+pldm_bios_table_iter_string_entry_value(const struct pldm_bios_table_iter *iter)
 {
 	return (const struct pldm_bios_string_table_entry *)
 	    pldm_bios_table_iter_value(iter);
@@ -76,7 +96,8 @@ pldm_bios_table_iter_string_entry_value(struct pldm_bios_table_iter *iter)
  *  @return Pointer to an entry in bios attribute value table
  */
 static inline const struct pldm_bios_attr_val_table_entry *
-pldm_bios_table_iter_attr_value_entry_value(struct pldm_bios_table_iter *iter)
+pldm_bios_table_iter_attr_value_entry_value(
+    const struct pldm_bios_table_iter *iter)
 {
 	return (const struct pldm_bios_attr_val_table_entry *)
 	    pldm_bios_table_iter_value(iter);
@@ -219,6 +240,16 @@ struct pldm_bios_table_attr_entry_enum_info {
 size_t pldm_bios_table_attr_entry_enum_encode_length(uint8_t pv_num,
 						     uint8_t def_num);
 
+/** @brief Check fields in @ref pldm_bios_table_attr_entry_enum_info
+ *  @param[in] info - Pointer to the pldm_bios_table_attr_entry_enum_info
+ *  @param[out] errmsg - Pointer to an errmsg stored in the statically allocated
+ * memory
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_attr_entry_enum_info_check(
+    const struct pldm_bios_table_attr_entry_enum_info *info,
+    const char **errmsg);
+
 /** @brief Create an entry of BIOS Attribute Table (type: enum)
  *  @param[out] entry - Pointer to a buffer to create an entry
  *  @param[in] entry_length - Length of the buffer to create an entry
@@ -509,7 +540,7 @@ size_t pldm_bios_table_attr_value_entry_encode_enum_length(uint8_t count);
  */
 void pldm_bios_table_attr_value_entry_encode_enum(
     void *entry, size_t entry_length, uint16_t attr_handle, uint8_t attr_type,
-    uint8_t count, uint8_t *handle_indexes);
+    uint8_t count, const uint8_t *handle_indexes);
 
 /** @brief Get number of current values for the enum entry
  *  @param[in] entry - Pointer to bios attribute value table entry
@@ -544,7 +575,7 @@ uint8_t pldm_bios_table_attr_value_entry_enum_decode_handles(
  */
 int pldm_bios_table_attr_value_entry_encode_enum_check(
     void *entry, size_t entry_length, uint16_t attr_handle, uint8_t attr_type,
-    uint8_t count, uint8_t *handle_indexes);
+    uint8_t count, const uint8_t *handle_indexes);
 
 /** @brief Get length that an attribute value entry(type: string) will take
  *  @param[in] string_length - Length of the current string in byte, 0 indicates
@@ -673,6 +704,193 @@ const struct pldm_bios_attr_val_table_entry *
 pldm_bios_table_attr_value_find_by_handle(const void *table, size_t length,
 					  uint16_t handle);
 
+/** @struct pldm_bios_table_builder
+ *  structure representing the context of building a bios table
+ *
+ *  The builder allocates the handles of the entries of one table, from 0, and
+ *  writes the entries to the output buffer. The first error is kept, later
+ *  additions fail with it. The *_entry_*_encode functions take handles from
+ *  process-wide counters instead, tables built with a builder don't depend on
+ *  the tables built before and can be built concurrently.
+ *  A builder without a buffer only sizes the table: the additions are checked
+ *  and allocated handles but nothing is written, and finishing it gives the
+ *  total size of the table. Adding the same entries to a builder with a
+ *  buffer of that size then builds the table with a single allocation.
+ *  The members are private, use the pldm_bios_table_builder_* APIs.
+ */
+struct pldm_bios_table_builder {
+	uint8_t *table;
+	size_t size;
+	size_t length;
+	uint16_t next_handle;
+	int rc;
+	const char *errmsg;
+};
+
+/** @brief Initialize a bios table builder
+ *  @param[out] builder - Pointer to the builder
+ *  @param[in] table - Pointer to a buffer to build the table in, NULL to only
+ *                     size the table
+ *  @param[in] size - Size of the buffer
+ */
+void pldm_bios_table_builder_init(struct pldm_bios_table_builder *builder,
+				  void *table, size_t size);
+
+/** @brief Move a bios table builder to another buffer, e.g. after growing it
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[in] table - Pointer to the buffer, holding the entries added so far
+ *  @param[in] size - Size of the buffer
+ */
+void pldm_bios_table_builder_set_buffer(
+    struct pldm_bios_table_builder *builder, void *table, size_t size);
+
+/** @brief Add an entry to a bios string table
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[in] str - String itself
+ *  @param[in] str_length - Length of the string
+ *  @param[out] handle - Handle of the new entry, may be NULL
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_builder_string_add(
+    struct pldm_bios_table_builder *builder, const char *str,
+    uint16_t str_length, uint16_t *handle);
+
+/** @brief Add an entry to a bios attribute table (type: enum)
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[in] info - Pointer to an auxiliary structure @ref
+ * pldm_bios_table_attr_entry_enum_info
+ *  @param[out] handle - Handle of the new entry, may be NULL
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_builder_attr_enum_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_enum_info *info, uint16_t *handle);
+
+/** @brief Add an entry to a bios attribute table (type: string)
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[in] info - Pointer to an auxiliary structure @ref
+ * pldm_bios_table_attr_entry_string_info
+ *  @param[out] handle - Handle of the new entry, may be NULL
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_builder_attr_string_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_string_info *info,
+    uint16_t *handle);
+
+/** @brief Add an entry to a bios attribute table (type: integer)
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[in] info - Pointer to an auxiliary structure @ref
+ * pldm_bios_table_attr_entry_integer_info
+ *  @param[out] handle - Handle of the new entry, may be NULL
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_builder_attr_integer_add(
+    struct pldm_bios_table_builder *builder,
+    const struct pldm_bios_table_attr_entry_integer_info *info,
+    uint16_t *handle);
+
+/** @brief Append pad and checksum to the table built
+ *  @param[in,out] builder - Pointer to the builder
+ *  @param[out] length - Total size of the table, pad and checksum included,
+ *                       also when the builder only sizes the table
+ *  @return pldm_completion_codes, the first error of the builder if any
+ */
+int pldm_bios_table_builder_finish(struct pldm_bios_table_builder *builder,
+				   size_t *length);
+
+/** @brief Get the message of the first error of a bios table builder
+ *  @param[in] builder - Pointer to the builder
+ *  @return The message, NULL if there was no error or no message
+ */
+static inline const char *
+pldm_bios_table_builder_errmsg(const struct pldm_bios_table_builder *builder)
+{
+	return builder->errmsg;
+}
+
+/** @struct pldm_bios_table_index
+ *  structure representing an index of the entries of a bios table by handle
+ *
+ *  The index holds the offsets of the entries from the start of the table, it
+ *  doesn't refer to the table data. It can be used with any copy of the table
+ *  it was created from, e.g. a table moved to another buffer, mmap'd from a
+ *  file or borrowed from a response message.
+ *  The index of a string table also orders the entries by string, for lookups
+ *  by string with a binary search.
+ */
+struct pldm_bios_table_index;
+
+/** @brief Create an index of a bios table by handle, in a single pass over
+ *         the table
+ *  @param[in] table - Pointer to table data
+ *  @param[in] length - Length of table data
+ *  @param[in] type - Type of pldm bios table
+ *  @return Pointer to the index, NULL on failure. The index must be released
+ *          with pldm_bios_table_index_free
+ */
+struct pldm_bios_table_index *
+pldm_bios_table_index_create(const void *table, size_t length,
+			     enum pldm_bios_table_types type);
+
+/** @brief Release an index of a bios table
+ *  @param[in] index - Pointer to the index
+ */
+void pldm_bios_table_index_free(struct pldm_bios_table_index *index);
+
+/** @brief Find an entry in bios string table by handle, using an index
+ *  @param[in] table - The BIOS String Table
+ *  @param[in] length - Length of the BIOS String Table
+ *  @param[in] index - Index created from the table
+ *  @param[in] handle - Handle to identify a string in the bios string table
+ *  @return Pointer to an entry in the bios string table, NULL if not found or
+ *          if the index was not created from a string table of this length
+ */
+const struct pldm_bios_string_table_entry *
+pldm_bios_table_string_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle);
+
+/** @brief Find an entry in bios string table by string, using an index
+ *  @param[in] table - The BIOS String Table
+ *  @param[in] length - Length of the BIOS String Table
+ *  @param[in] index - Index created from the table
+ *  @param[in] str - String itself
+ *  @return Pointer to an entry in the bios string table, NULL if not found or
+ *          if the index was not created from a string table of this length
+ */
+const struct pldm_bios_string_table_entry *
+pldm_bios_table_string_find_by_string_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, const char *str);
+
+/** @brief Find an entry in attribute table by handle, using an index
+ *  @param[in] table - The BIOS Attribute Table
+ *  @param[in] length - Length of the BIOS Attribute Table
+ *  @param[in] index - Index created from the table
+ *  @param[in] handle - handle to identify the attribute in the attribute table
+ *  @return Pointer to the entry, NULL if not found or if the index was not
+ *          created from an attribute table of this length
+ */
+const struct pldm_bios_attr_table_entry *
+pldm_bios_table_attr_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle);
+
+/** @brief Find an entry in attribute value table by handle, using an index
+ *  @param[in] table - The BIOS Attribute Value Table
+ *  @param[in] length - Length of the BIOS Attribute Value Table
+ *  @param[in] index - Index created from the table
+ *  @param[in] handle - handle to identify the attribute in the attribute value
+ * table
+ *  @return Pointer to the entry, NULL if not found or if the index was not
+ *          created from an attribute value table of this length
+ */
+const struct pldm_bios_attr_val_table_entry *
+pldm_bios_table_attr_value_find_by_handle_index(
+    const void *table, size_t length,
+    const struct pldm_bios_table_index *index, uint16_t handle);
+
 /** @brief Get the size of pad and checksum
  *  @param[in] size_without_pad - Table size without pad
  *  @return The size of pad and checksum
@@ -704,6 +922,101 @@ int pldm_bios_table_attr_value_copy_and_update(
     const void *src_table, size_t src_length, void *dest_table,
     size_t *dest_length, const void *entry, size_t entry_length);
 
+/** @brief Update an entry of an attribute value table in place
+ *
+ *  An entry of the same size is patched and the checksum is updated from the
+ *  patched bytes only. Otherwise the entries after it are moved, and only the
+ *  moved part of the table is checksummed.
+ *  @param[in,out] table - Pointer to a buffer holding an attribute value
+ *                         table, with pad and checksum
+ *  @param[in,out] length - Length of the table as input parameter and will be
+ *                          assigned the length of the updated table, if the
+ *                          function returns PLDM_SUCCESS
+ *  @param[in] size - Size of the buffer
+ *  @param[in] entry - Pointer to an entry
+ *  @param[in] entry_length - Size of the entry
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_attr_value_update_in_place(void *table, size_t *length,
+					       size_t size, const void *entry,
+					       size_t entry_length);
+
+/** @brief Update an entry of an attribute value table in place, using an index
+ *
+ *  As pldm_bios_table_attr_value_update_in_place(), the entry is found with
+ *  the index rather than with a search of the table. When the size of the
+ *  entry changes, the index is adjusted to the updated table.
+ *  @param[in,out] table - Pointer to a buffer holding an attribute value
+ *                         table, with pad and checksum
+ *  @param[in,out] length - Length of the table as input parameter and will be
+ *                          assigned the length of the updated table, if the
+ *                          function returns PLDM_SUCCESS
+ *  @param[in] size - Size of the buffer
+ *  @param[in,out] index - Index created from the table
+ *  @param[in] entry - Pointer to an entry
+ *  @param[in] entry_length - Size of the entry
+ *  @return pldm_completion_codes
+ */
+int pldm_bios_table_attr_value_update_in_place_index(
+    void *table, size_t *length, size_t size,
+    struct pldm_bios_table_index *index, const void *entry,
+    size_t entry_length);
+
+/** @enum pldm_bios_table_defect
+ *  the first defect found by pldm_bios_table_validate()
+ */
+enum pldm_bios_table_defect {
+	PLDM_BIOS_TABLE_NO_DEFECT,
+	/* An entry or the checksum runs past the end of the table */
+	PLDM_BIOS_TABLE_TRUNCATED,
+	/* An attribute type unknown to the table type */
+	PLDM_BIOS_TABLE_UNKNOWN_ATTR_TYPE,
+	PLDM_BIOS_TABLE_DUPLICATE_HANDLE,
+	/* A handle not found in the referenced table */
+	PLDM_BIOS_TABLE_DANGLING_HANDLE,
+	/* An attribute value of another type than its attribute */
+	PLDM_BIOS_TABLE_ATTR_TYPE_MISMATCH,
+	/* Pad of the wrong size or not zeroed */
+	PLDM_BIOS_TABLE_BAD_PAD,
+	PLDM_BIOS_TABLE_BAD_CHECKSUM,
+};
+
+/** @struct pldm_bios_table_validation
+ *  report of pldm_bios_table_validate()
+ */
+struct pldm_bios_table_validation {
+	enum pldm_bios_table_defect defect;
+	size_t offset;	       //!< offset of the defect, or of the pad if none
+	uint16_t handle;       //!< handle of the defective entry, or dangling
+	size_t entries;	       //!< number of entries validated
+};
+
+/** @brief Validate a bios table in a single pass
+ *
+ *  Checks that the entries are well formed and end before the pad, that their
+ *  handles are unique, that the pad is of the right size and zeroed, and the
+ *  checksum. With a reference table, the string handles of an attribute table
+ *  must be found in the string table, and the attributes of an attribute
+ *  value table in the attribute table, with the same types. The reference
+ *  table is trusted, it should have been validated first.
+ *  A table that passed can be looked up without further checks.
+ *  @param[in] table - Pointer to table data
+ *  @param[in] length - Length of table data
+ *  @param[in] type - Type of pldm bios table
+ *  @param[in] ref_table - Pointer to the string table of an attribute table,
+ *                         or the attribute table of an attribute value table,
+ *                         may be NULL to skip the references checks
+ *  @param[in] ref_length - Length of the reference table
+ *  @param[out] report - Pointer to the report, may be NULL
+ *  @return PLDM_SUCCESS if the table is valid, PLDM_ERROR_INVALID_DATA with
+ *          the defect reported otherwise, PLDM_ERROR if the validation could
+ *          not run
+ */
+int pldm_bios_table_validate(const void *table, size_t length,
+			     enum pldm_bios_table_types type,
+			     const void *ref_table, size_t ref_length,
+			     struct pldm_bios_table_validation *report);
+
 #ifdef __cplusplus
 }
 #endif
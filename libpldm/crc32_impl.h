@@ -0,0 +1,50 @@
+#ifndef CRC32_IMPL_H
+#define CRC32_IMPL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* The implementations behind crc32(), not part of the libpldm API. They are
+ * exposed so that tests can check each one the CPU running them supports,
+ * not only the one crc32() picks.
+ */
+
+/** @enum crc32_impl
+ *  an implementation of Crc32
+ */
+enum crc32_impl {
+	CRC32_IMPL_SLICE8, /* slicing-by-8 tables, always supported */
+	CRC32_IMPL_ARMV8,  /* ARMv8 CRC32 instructions */
+	CRC32_IMPL_PCLMUL, /* x86 carry-less multiplication folding */
+};
+
+/** @brief Check whether an implementation of Crc32 can run here
+ *
+ *  @param[in] impl - The implementation
+ *  @return true if it is built in and the CPU supports it
+ */
+bool crc32_impl_supported(enum crc32_impl impl);
+
+/** @brief Continue a Crc32 over more data with a given implementation
+ *
+ *  Same as crc32_update(), the implementation must be supported.
+ *
+ *  @param[in] impl - The implementation
+ *  @param[in] crc - Crc32 of the data before
+ *  @param[in] data - Pointer to the target data
+ *  @param[in] size - Size of the data
+ *  @return The checksum
+ */
+uint32_t crc32_impl_update(enum crc32_impl impl, uint32_t crc,
+			   const void *data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC32_IMPL_H */
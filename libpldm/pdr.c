@@ -1,6 +1,9 @@
 #include "pdr.h"
 #include "platform.h"
+#include "utils.h"
 #include <assert.h>
+#include <endian.h>
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -9,6 +12,9 @@ typedef struct pldm_pdr_record {
 	uint32_t size;
 	uint8_t *data;
 	struct pldm_pdr_record *next;
+	/* record refers to an attached image: data is not owned and the record
+	 * itself is part of pldm_pdr.image_records */
+	bool in_image;
 } pldm_pdr_record;
 
 typedef struct pldm_pdr {
@@ -17,8 +23,37 @@ typedef struct pldm_pdr {
 	uint32_t last_used_record_handle;
 	pldm_pdr_record *first;
 	pldm_pdr_record *last;
+	pldm_pdr_record *image_records;
+	uint32_t largest_record_size;
+	/* signature covers records up to and including last_signed; records
+	 * after it were added in place and may still be under construction */
+	uint32_t signature;
+	const pldm_pdr_record *last_signed;
 } pldm_pdr;
 
+/* "PPDR", stored little-endian */
+#define PDR_IMAGE_MAGIC 0x52445050
+
+/* All image fields are little-endian; records follow the header back to back,
+ * each one being a pdr_image_record_hdr followed by size bytes of PDR data. The
+ * checksum covers everything after the header.
+ */
+struct pdr_image_hdr {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t reserved;
+	uint32_t record_count;
+	uint32_t repo_size;
+	uint32_t last_used_record_handle;
+	uint32_t image_size;
+	uint32_t checksum;
+} __attribute__((packed));
+
+struct pdr_image_record_hdr {
+	uint32_t record_handle;
+	uint32_t size;
+} __attribute__((packed));
+
 static inline uint32_t get_next_record_handle(const pldm_pdr *repo,
 					      const pldm_pdr_record *record)
 {
@@ -31,11 +66,39 @@ static inline uint32_t get_next_record_handle(const pldm_pdr *repo,
 	return record->next->record_handle;
 }
 
-static void add_record(pldm_pdr *repo, pldm_pdr_record *record)
+/* Chain a record into a repository signature */
+static uint32_t sign_record(uint32_t signature, const pldm_pdr_record *record)
+{
+	uint32_t link[4] = {htole32(signature), htole32(record->record_handle),
+			    htole32(record->size),
+			    htole32(crc32(record->data, record->size))};
+
+	return crc32(link, sizeof(link));
+}
+
+/* Fold records added in place, which are complete once another record is
+ * added after them, into the repository signature.
+ */
+static void sign_pending_records(pldm_pdr *repo)
+{
+	const pldm_pdr_record *record =
+	    repo->last_signed ? repo->last_signed->next : repo->first;
+	while (record != NULL) {
+		repo->signature = sign_record(repo->signature, record);
+		repo->last_signed = record;
+		record = record->next;
+	}
+}
+
+/* Link a record at the end of a repository; a complete record is folded into
+ * the signature right away, one added in place is folded in later.
+ */
+static void add_record(pldm_pdr *repo, pldm_pdr_record *record, bool complete)
 {
 	assert(repo != NULL);
 	assert(record != NULL);
 
+	sign_pending_records(repo);
 	if (repo->first == NULL) {
 		assert(repo->last == NULL);
 		repo->first = record;
@@ -47,6 +110,13 @@ static void add_record(pldm_pdr *repo, pldm_pdr_record *record)
 	repo->size += record->size;
 	repo->last_used_record_handle = record->record_handle;
 	++repo->record_count;
+	if (record->size > repo->largest_record_size) {
+		repo->largest_record_size = record->size;
+	}
+	if (complete) {
+		repo->signature = sign_record(repo->signature, record);
+		repo->last_signed = record;
+	}
 }
 
 static inline uint32_t get_new_record_handle(const pldm_pdr *repo)
@@ -69,23 +139,26 @@ static pldm_pdr_record *make_new_record(const pldm_pdr *repo,
 	record->record_handle =
 	    record_handle == 0 ? get_new_record_handle(repo) : record_handle;
 	record->size = size;
+	record->data = malloc(size);
+	assert(record->data != NULL);
 	if (data != NULL) {
-		record->data = malloc(size);
-		assert(record->data != NULL);
 		memcpy(record->data, data, size);
-		/* If record handle is 0, that is an indication for this API to
-		 * compute a new handle. For that reason, the computed handle
-		 * needs to be populated in the PDR header. For a case where the
-		 * caller supplied the record handle, it would exist in the
-		 * header already.
-		 */
-		if (!record_handle) {
-			struct pldm_pdr_hdr *hdr =
-			    (struct pldm_pdr_hdr *)(record->data);
-			hdr->record_handle = record->record_handle;
-		}
+	} else {
+		memset(record->data, 0, size);
+	}
+	/* If record handle is 0, that is an indication for this API to
+	 * compute a new handle. For that reason, the computed handle
+	 * needs to be populated in the PDR header. For a case where the
+	 * caller supplied the record handle, it would exist in the
+	 * header already.
+	 */
+	if (!record_handle) {
+		struct pldm_pdr_hdr *hdr =
+		    (struct pldm_pdr_hdr *)(record->data);
+		hdr->record_handle = record->record_handle;
 	}
 	record->next = NULL;
+	record->in_image = false;
 
 	return record;
 }
@@ -98,7 +171,21 @@ uint32_t pldm_pdr_add(pldm_pdr *repo, const uint8_t *data, uint32_t size,
 
 	pldm_pdr_record *record =
 	    make_new_record(repo, data, size, record_handle);
-	add_record(repo, record);
+	add_record(repo, record, true);
+
+	return record->record_handle;
+}
+
+uint32_t pldm_pdr_add_in_place(pldm_pdr *repo, uint32_t size,
+			       uint32_t record_handle, uint8_t **data)
+{
+	assert(size != 0);
+	assert(data != NULL);
+
+	pldm_pdr_record *record =
+	    make_new_record(repo, NULL, size, record_handle);
+	add_record(repo, record, false);
+	*data = record->data;
 
 	return record->record_handle;
 }
@@ -112,6 +199,10 @@ pldm_pdr *pldm_pdr_init()
 	repo->last_used_record_handle = 0;
 	repo->first = NULL;
 	repo->last = NULL;
+	repo->image_records = NULL;
+	repo->largest_record_size = 0;
+	repo->signature = 0;
+	repo->last_signed = NULL;
 
 	return repo;
 }
@@ -123,13 +214,16 @@ void pldm_pdr_destroy(pldm_pdr *repo)
 	pldm_pdr_record *record = repo->first;
 	while (record != NULL) {
 		pldm_pdr_record *next = record->next;
-		if (record->data) {
-			free(record->data);
-			record->data = NULL;
+		if (!record->in_image) {
+			if (record->data) {
+				free(record->data);
+				record->data = NULL;
+			}
+			free(record);
 		}
-		free(record);
 		record = next;
 	}
+	free(repo->image_records);
 	free(repo);
 }
 
@@ -228,6 +322,28 @@ uint32_t pldm_pdr_get_repo_size(const pldm_pdr *repo)
 	return repo->size;
 }
 
+uint32_t pldm_pdr_get_largest_record_size(const pldm_pdr *repo)
+{
+	assert(repo != NULL);
+
+	return repo->largest_record_size;
+}
+
+uint32_t pldm_pdr_get_signature(const pldm_pdr *repo)
+{
+	assert(repo != NULL);
+
+	uint32_t signature = repo->signature;
+	const pldm_pdr_record *record =
+	    repo->last_signed ? repo->last_signed->next : repo->first;
+	while (record != NULL) {
+		signature = sign_record(signature, record);
+		record = record->next;
+	}
+
+	return signature;
+}
+
 uint32_t pldm_pdr_get_record_handle(const pldm_pdr *repo,
 				    const pldm_pdr_record *record)
 {
@@ -237,6 +353,209 @@ uint32_t pldm_pdr_get_record_handle(const pldm_pdr *repo,
 	return record->record_handle;
 }
 
+size_t pldm_pdr_get_image_size(const pldm_pdr *repo)
+{
+	assert(repo != NULL);
+
+	return sizeof(struct pdr_image_hdr) +
+	       (size_t)repo->record_count *
+		   sizeof(struct pdr_image_record_hdr) +
+	       repo->size;
+}
+
+int pldm_pdr_serialize(const pldm_pdr *repo, uint8_t *image, size_t image_len)
+{
+	if (repo == NULL || image == NULL) {
+		return PLDM_ERROR_INVALID_DATA;
+	}
+	size_t image_size = pldm_pdr_get_image_size(repo);
+	if (image_len < image_size || image_size > UINT32_MAX) {
+		return PLDM_ERROR_INVALID_LENGTH;
+	}
+
+	uint8_t *pos = image + sizeof(struct pdr_image_hdr);
+	const pldm_pdr_record *record = repo->first;
+	while (record != NULL) {
+		struct pdr_image_record_hdr *record_hdr =
+		    (struct pdr_image_record_hdr *)pos;
+		record_hdr->record_handle = htole32(record->record_handle);
+		record_hdr->size = htole32(record->size);
+		pos += sizeof(*record_hdr);
+		memcpy(pos, record->data, record->size);
+		pos += record->size;
+		record = record->next;
+	}
+
+	struct pdr_image_hdr *hdr = (struct pdr_image_hdr *)image;
+	hdr->magic = htole32(PDR_IMAGE_MAGIC);
+	hdr->version = htole16(PLDM_PDR_IMAGE_VERSION);
+	hdr->reserved = 0;
+	hdr->record_count = htole32(repo->record_count);
+	hdr->repo_size = htole32(repo->size);
+	hdr->last_used_record_handle = htole32(repo->last_used_record_handle);
+	hdr->image_size = htole32(image_size);
+	hdr->checksum = htole32(crc32(image + sizeof(*hdr),
+				      image_size - sizeof(*hdr)));
+
+	return PLDM_SUCCESS;
+}
+
+static int compare_handles(const void *a, const void *b)
+{
+	uint32_t lhs = *(const uint32_t *)a;
+	uint32_t rhs = *(const uint32_t *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+/* Check no two records of a well framed image share a record handle, lookups
+ * by handle would otherwise find either of them.
+ */
+static bool image_handles_unique(const uint8_t *records, uint32_t record_count)
+{
+	if (record_count < 2) {
+		return true;
+	}
+	uint32_t *handles = malloc(record_count * sizeof(uint32_t));
+	if (handles == NULL) {
+		return false;
+	}
+
+	const uint8_t *pos = records;
+	for (uint32_t i = 0; i < record_count; ++i) {
+		const struct pdr_image_record_hdr *record_hdr =
+		    (const struct pdr_image_record_hdr *)pos;
+		handles[i] = le32toh(record_hdr->record_handle);
+		pos += sizeof(*record_hdr) + le32toh(record_hdr->size);
+	}
+	qsort(handles, record_count, sizeof(uint32_t), compare_handles);
+	bool unique = true;
+	for (uint32_t i = 1; i < record_count && unique; ++i) {
+		unique = handles[i] != handles[i - 1];
+	}
+	free(handles);
+
+	return unique;
+}
+
+/* Validate the header, checksum, record framing and record handles of an
+ * image; on success return the header, NULL otherwise.
+ */
+static const struct pdr_image_hdr *image_check(const uint8_t *image,
+					       size_t image_len)
+{
+	if (image == NULL || image_len < sizeof(struct pdr_image_hdr)) {
+		return NULL;
+	}
+
+	const struct pdr_image_hdr *hdr = (const struct pdr_image_hdr *)image;
+	uint32_t image_size = le32toh(hdr->image_size);
+	if (le32toh(hdr->magic) != PDR_IMAGE_MAGIC ||
+	    le16toh(hdr->version) != PLDM_PDR_IMAGE_VERSION ||
+	    image_size < sizeof(*hdr) || image_size > image_len) {
+		return NULL;
+	}
+	if (le32toh(hdr->checksum) !=
+	    crc32(image + sizeof(*hdr), image_size - sizeof(*hdr))) {
+		return NULL;
+	}
+
+	uint32_t record_count = le32toh(hdr->record_count);
+	uint64_t repo_size = 0;
+	size_t offset = sizeof(*hdr);
+	for (uint32_t i = 0; i < record_count; ++i) {
+		if (image_size - offset < sizeof(struct pdr_image_record_hdr)) {
+			return NULL;
+		}
+		const struct pdr_image_record_hdr *record_hdr =
+		    (const struct pdr_image_record_hdr *)(image + offset);
+		uint32_t size = le32toh(record_hdr->size);
+		offset += sizeof(*record_hdr);
+		if (size == 0 || record_hdr->record_handle == 0 ||
+		    image_size - offset < size) {
+			return NULL;
+		}
+		offset += size;
+		repo_size += size;
+	}
+	if (offset != image_size || repo_size != le32toh(hdr->repo_size)) {
+		return NULL;
+	}
+	if (!image_handles_unique(image + sizeof(*hdr), record_count)) {
+		return NULL;
+	}
+
+	return hdr;
+}
+
+pldm_pdr *pldm_pdr_deserialize(const uint8_t *image, size_t image_len)
+{
+	const struct pdr_image_hdr *hdr = image_check(image, image_len);
+	if (hdr == NULL) {
+		return NULL;
+	}
+
+	pldm_pdr *repo = pldm_pdr_init();
+	uint32_t record_count = le32toh(hdr->record_count);
+	const uint8_t *pos = image + sizeof(*hdr);
+	for (uint32_t i = 0; i < record_count; ++i) {
+		const struct pdr_image_record_hdr *record_hdr =
+		    (const struct pdr_image_record_hdr *)pos;
+		uint32_t size = le32toh(record_hdr->size);
+		pos += sizeof(*record_hdr);
+		pldm_pdr_add(repo, pos, size,
+			     le32toh(record_hdr->record_handle));
+		pos += size;
+	}
+	repo->last_used_record_handle =
+	    le32toh(hdr->last_used_record_handle);
+
+	return repo;
+}
+
+pldm_pdr *pldm_pdr_attach_image(const uint8_t *image, size_t image_len)
+{
+	const struct pdr_image_hdr *hdr = image_check(image, image_len);
+	if (hdr == NULL) {
+		return NULL;
+	}
+
+	pldm_pdr *repo = pldm_pdr_init();
+	uint32_t record_count = le32toh(hdr->record_count);
+	if (record_count == 0) {
+		repo->last_used_record_handle =
+		    le32toh(hdr->last_used_record_handle);
+		return repo;
+	}
+
+	repo->image_records = malloc(record_count * sizeof(pldm_pdr_record));
+	if (repo->image_records == NULL) {
+		pldm_pdr_destroy(repo);
+		return NULL;
+	}
+	const uint8_t *pos = image + sizeof(*hdr);
+	for (uint32_t i = 0; i < record_count; ++i) {
+		const struct pdr_image_record_hdr *record_hdr =
+		    (const struct pdr_image_record_hdr *)pos;
+		pldm_pdr_record *record = &repo->image_records[i];
+		record->record_handle = le32toh(record_hdr->record_handle);
+		record->size = le32toh(record_hdr->size);
+		pos += sizeof(*record_hdr);
+		/* The API hands out non-const record data, attached records
+		 * are documented to be read-only.
+		 */
+		record->data = (uint8_t *)pos;
+		record->next = NULL;
+		record->in_image = true;
+		pos += record->size;
+		add_record(repo, record, true);
+	}
+	repo->last_used_record_handle =
+	    le32toh(hdr->last_used_record_handle);
+
+	return repo;
+}
+
 uint32_t pldm_pdr_add_fru_record_set(pldm_pdr *repo, uint16_t terminus_handle,
 				     uint16_t fru_rsi, uint16_t entity_type,
 				     uint16_t entity_instance_num,
@@ -5,6 +5,7 @@
 extern "C" {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 /** @struct pldm_pdr
@@ -54,6 +55,29 @@ uint32_t pldm_pdr_get_record_count(const pldm_pdr *repo);
  */
 uint32_t pldm_pdr_get_repo_size(const pldm_pdr *repo);
 
+/** @brief Get size of the largest record of a PDR repository, in bytes
+ *
+ *  @param[in] repo - opaque pointer acting as a PDR repo handle
+ *
+ *  @return uint32_t - size in bytes
+ */
+uint32_t pldm_pdr_get_largest_record_size(const pldm_pdr *repo);
+
+/** @brief Get the signature of a PDR repository
+ *
+ *  The signature is a CRC32 chained over the record handle, size and data of
+ *  every record, in repository order; it changes whenever a record is added.
+ *  It is maintained incrementally as records are added. A record added with
+ *  pldm_pdr_add_in_place() is folded in when the next record is added, so it
+ *  must be fully constructed by then; until that point it is accounted for
+ *  by every query.
+ *
+ *  @param[in] repo - opaque pointer acting as a PDR repo handle
+ *
+ *  @return uint32_t - signature of the repository, 0 for an empty repository
+ */
+uint32_t pldm_pdr_get_signature(const pldm_pdr *repo);
+
 /** @brief Add a PDR record to a PDR repository
  *
  *  @param[in/out] repo - opaque pointer acting as a PDR repo handle
@@ -68,6 +92,25 @@ uint32_t pldm_pdr_get_repo_size(const pldm_pdr *repo);
 uint32_t pldm_pdr_add(pldm_pdr *repo, const uint8_t *data, uint32_t size,
 		      uint32_t record_handle);
 
+/** @brief Add a PDR record to a PDR repository, to be constructed in place
+ *
+ *  Unlike pldm_pdr_add(), the caller does not provide the record data; the
+ *  repository allocates it and the caller writes the PDR directly into it,
+ *  which avoids building the record in a temporary buffer first.
+ *
+ *  @param[in/out] repo - opaque pointer acting as a PDR repo handle
+ *  @param[in] size - size of the PDR record in bytes
+ *  @param[in] record_handle - record handle of the PDR record; if this is set
+ *  to 0, then a record handle is computed and assigned to this PDR record
+ *  @param[out] data - *data will point to the zero-initialized PDR record,
+ *  owned by the repository. If a record handle was computed, it is already
+ *  populated in the PDR header and must not be overwritten.
+ *
+ *  @return uint32_t - record handle assigned to PDR record
+ */
+uint32_t pldm_pdr_add_in_place(pldm_pdr *repo, uint32_t size,
+			       uint32_t record_handle, uint8_t **data);
+
 /** @brief Get record handle of a PDR record
  *
  *  @param[in] repo - opaque pointer acting as a PDR repo handle
@@ -133,6 +176,65 @@ pldm_pdr_find_record_by_type(const pldm_pdr *repo, uint8_t pdr_type,
 			     const pldm_pdr_record *curr_record, uint8_t **data,
 			     uint32_t *size);
 
+/* ========================= */
+/* PDR repository image APIs */
+/* ========================= */
+
+/** @brief Current version of the serialized PDR repository image format
+ */
+#define PLDM_PDR_IMAGE_VERSION 1
+
+/** @brief Get the size of the serialized image of a PDR repository
+ *
+ *  @param[in] repo - opaque pointer acting as a PDR repo handle
+ *
+ *  @return size_t - size in bytes of the image pldm_pdr_serialize() produces
+ */
+size_t pldm_pdr_get_image_size(const pldm_pdr *repo);
+
+/** @brief Serialize a PDR repository into a binary image
+ *
+ *  The image is versioned, CRC32 protected and position-independent (it holds
+ *  no pointers), so it can be written to a file and later deserialized or
+ *  attached to, possibly by a different process.
+ *
+ *  @param[in] repo - opaque pointer acting as a PDR repo handle
+ *  @param[out] image - buffer the image is written to
+ *  @param[in] image_len - size of the image buffer, must be at least
+ *  pldm_pdr_get_image_size()
+ *
+ *  @return pldm_completion_codes
+ */
+int pldm_pdr_serialize(const pldm_pdr *repo, uint8_t *image, size_t image_len);
+
+/** @brief Make a new PDR repository from a binary image, copying the records
+ *
+ *  @param[in] image - image produced by pldm_pdr_serialize()
+ *  @param[in] image_len - size of the image in bytes
+ *
+ *  @return opaque pointer that acts as a handle to the repository; NULL if the
+ *  image is malformed, has an unsupported version, a checksum mismatch or two
+ *  records with the same handle
+ */
+pldm_pdr *pldm_pdr_deserialize(const uint8_t *image, size_t image_len);
+
+/** @brief Make a new PDR repository that refers to the records of a binary
+ *  image in place, without copying them
+ *
+ *  The image is typically a read-only mmap() of a file; it must stay mapped
+ *  until the repository is destroyed. Record data returned for records of the
+ *  image points into the image and must not be modified. Records added later
+ *  with pldm_pdr_add() are owned by the repository as usual.
+ *
+ *  @param[in] image - image produced by pldm_pdr_serialize()
+ *  @param[in] image_len - size of the image in bytes
+ *
+ *  @return opaque pointer that acts as a handle to the repository; NULL if the
+ *  image is malformed, has an unsupported version, a checksum mismatch or two
+ *  records with the same handle, or if memory could not be allocated
+ */
+pldm_pdr *pldm_pdr_attach_image(const uint8_t *image, size_t image_len);
+
 /* ======================= */
 /* FRU Record Set PDR APIs */
 /* ======================= */
@@ -171,6 +171,82 @@ int encode_get_pdr_resp(uint8_t instance_id, uint8_t completion_code,
 	return PLDM_SUCCESS;
 }
 
+int encode_get_pdr_repository_info_resp(
+    uint8_t instance_id, uint8_t completion_code, uint8_t repository_state,
+    const uint8_t *update_time, const uint8_t *oem_update_time,
+    uint32_t record_count, uint32_t repository_size,
+    uint32_t largest_record_size, uint8_t data_transfer_handle_timeout,
+    struct pldm_msg *msg)
+{
+	struct pldm_header_info header = {0};
+	int rc = PLDM_SUCCESS;
+
+	if (msg == NULL) {
+		return PLDM_ERROR_INVALID_DATA;
+	}
+	struct pldm_get_pdr_repository_info_resp *response =
+	    (struct pldm_get_pdr_repository_info_resp *)msg->payload;
+
+	response->completion_code = completion_code;
+
+	header.msg_type = PLDM_RESPONSE;
+	header.instance = instance_id;
+	header.pldm_type = PLDM_PLATFORM;
+	header.command = PLDM_GET_PDR_REPOSITORY_INFO;
+	if ((rc = pack_pldm_header(&header, &(msg->hdr))) > PLDM_SUCCESS) {
+		return rc;
+	}
+
+	if (response->completion_code == PLDM_SUCCESS) {
+		if (update_time == NULL || oem_update_time == NULL) {
+			return PLDM_ERROR_INVALID_DATA;
+		}
+		response->repository_state = repository_state;
+		memcpy(response->update_time, update_time,
+		       PLDM_TIMESTAMP104_SIZE);
+		memcpy(response->oem_update_time, oem_update_time,
+		       PLDM_TIMESTAMP104_SIZE);
+		response->record_count = htole32(record_count);
+		response->repository_size = htole32(repository_size);
+		response->largest_record_size = htole32(largest_record_size);
+		response->data_transfer_handle_timeout =
+		    data_transfer_handle_timeout;
+	}
+
+	return PLDM_SUCCESS;
+}
+
+int encode_get_pdr_repository_signature_resp(uint8_t instance_id,
+					     uint8_t completion_code,
+					     uint32_t repository_signature,
+					     struct pldm_msg *msg)
+{
+	struct pldm_header_info header = {0};
+	int rc = PLDM_SUCCESS;
+
+	if (msg == NULL) {
+		return PLDM_ERROR_INVALID_DATA;
+	}
+	struct pldm_get_pdr_repository_signature_resp *response =
+	    (struct pldm_get_pdr_repository_signature_resp *)msg->payload;
+
+	response->completion_code = completion_code;
+
+	header.msg_type = PLDM_RESPONSE;
+	header.instance = instance_id;
+	header.pldm_type = PLDM_PLATFORM;
+	header.command = PLDM_GET_PDR_REPOSITORY_SIGNATURE;
+	if ((rc = pack_pldm_header(&header, &(msg->hdr))) > PLDM_SUCCESS) {
+		return rc;
+	}
+
+	if (response->completion_code == PLDM_SUCCESS) {
+		response->repository_signature = htole32(repository_signature);
+	}
+
+	return PLDM_SUCCESS;
+}
+
 int encode_get_pdr_req(uint8_t instance_id, uint32_t record_hndl,
 		       uint32_t data_transfer_hndl, uint8_t transfer_op_flag,
 		       uint16_t request_cnt, uint16_t record_chg_num,
@@ -207,6 +283,71 @@ int encode_get_pdr_req(uint8_t instance_id, uint32_t record_hndl,
 	return PLDM_SUCCESS;
 }
 
+int decode_get_pdr_repository_info_resp(
+    const struct pldm_msg *msg, size_t payload_length,
+    uint8_t *completion_code, uint8_t *repository_state,
+    uint8_t *update_time, uint8_t *oem_update_time, uint32_t *record_count,
+    uint32_t *repository_size, uint32_t *largest_record_size,
+    uint8_t *data_transfer_handle_timeout)
+{
+	if (msg == NULL || completion_code == NULL ||
+	    repository_state == NULL || update_time == NULL ||
+	    oem_update_time == NULL || record_count == NULL ||
+	    repository_size == NULL || largest_record_size == NULL ||
+	    data_transfer_handle_timeout == NULL) {
+		return PLDM_ERROR_INVALID_DATA;
+	}
+
+	*completion_code = msg->payload[0];
+	if (PLDM_SUCCESS != *completion_code) {
+		return PLDM_SUCCESS;
+	}
+
+	if (payload_length != PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES) {
+		return PLDM_ERROR_INVALID_LENGTH;
+	}
+
+	struct pldm_get_pdr_repository_info_resp *response =
+	    (struct pldm_get_pdr_repository_info_resp *)msg->payload;
+
+	*repository_state = response->repository_state;
+	memcpy(update_time, response->update_time, PLDM_TIMESTAMP104_SIZE);
+	memcpy(oem_update_time, response->oem_update_time,
+	       PLDM_TIMESTAMP104_SIZE);
+	*record_count = le32toh(response->record_count);
+	*repository_size = le32toh(response->repository_size);
+	*largest_record_size = le32toh(response->largest_record_size);
+	*data_transfer_handle_timeout = response->data_transfer_handle_timeout;
+
+	return PLDM_SUCCESS;
+}
+
+int decode_get_pdr_repository_signature_resp(const struct pldm_msg *msg,
+					     size_t payload_length,
+					     uint8_t *completion_code,
+					     uint32_t *repository_signature)
+{
+	if (msg == NULL || completion_code == NULL ||
+	    repository_signature == NULL) {
+		return PLDM_ERROR_INVALID_DATA;
+	}
+
+	*completion_code = msg->payload[0];
+	if (PLDM_SUCCESS != *completion_code) {
+		return PLDM_SUCCESS;
+	}
+
+	if (payload_length != PLDM_GET_PDR_REPOSITORY_SIGNATURE_RESP_BYTES) {
+		return PLDM_ERROR_INVALID_LENGTH;
+	}
+
+	struct pldm_get_pdr_repository_signature_resp *response =
+	    (struct pldm_get_pdr_repository_signature_resp *)msg->payload;
+	*repository_signature = le32toh(response->repository_signature);
+
+	return PLDM_SUCCESS;
+}
+
 int decode_get_pdr_resp(const struct pldm_msg *msg, size_t payload_length,
 			uint8_t *completion_code, uint32_t *next_record_hndl,
 			uint32_t *next_data_transfer_hndl,
@@ -24,6 +24,12 @@ extern "C" {
 /* Minimum response length */
 #define PLDM_GET_PDR_MIN_RESP_BYTES 12
 
+#define PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES 41
+#define PLDM_GET_PDR_REPOSITORY_SIGNATURE_RESP_BYTES 5
+
+/* Size of a timestamp104 as per DSP0248 */
+#define PLDM_TIMESTAMP104_SIZE 13
+
 enum pldm_effecter_data_size {
 	PLDM_EFFECTER_DATA_SIZE_UINT8,
 	PLDM_EFFECTER_DATA_SIZE_SINT8,
@@ -66,16 +72,28 @@ enum pldm_platform_commands {
 	PLDM_GET_STATE_SENSOR_READINGS = 0x21,
 	PLDM_SET_NUMERIC_EFFECTER_VALUE = 0x31,
 	PLDM_SET_STATE_EFFECTER_STATES = 0x39,
+	PLDM_GET_PDR_REPOSITORY_INFO = 0x50,
 	PLDM_GET_PDR = 0x51,
+	PLDM_GET_PDR_REPOSITORY_SIGNATURE = 0x53,
 };
 
 /** @brief PLDM PDR types
  */
 enum pldm_pdr_types {
+	PLDM_STATE_SENSOR_PDR = 4,
 	PLDM_STATE_EFFECTER_PDR = 11,
+	PLDM_PDR_ENTITY_ASSOCIATION = 15,
 	PLDM_PDR_FRU_RECORD_SET = 20,
 };
 
+/** @brief PLDM PDR repository states
+ */
+enum pldm_pdr_repository_state {
+	PLDM_PDR_REPOSITORY_AVAILABLE = 0,
+	PLDM_PDR_REPOSITORY_UPDATE_IN_PROGRESS = 1,
+	PLDM_PDR_REPOSITORY_FAILED = 2
+};
+
 /** @brief PLDM effecter initialization schemes
  */
 enum pldm_effecter_init {
@@ -206,6 +224,30 @@ struct pldm_get_pdr_req {
 	uint16_t record_change_number;
 } __attribute__((packed));
 
+/** @struct pldm_get_pdr_repository_info_resp
+ *
+ *  structure representing GetPDRRepositoryInfo response packet
+ */
+struct pldm_get_pdr_repository_info_resp {
+	uint8_t completion_code;
+	uint8_t repository_state;
+	uint8_t update_time[PLDM_TIMESTAMP104_SIZE];
+	uint8_t oem_update_time[PLDM_TIMESTAMP104_SIZE];
+	uint32_t record_count;
+	uint32_t repository_size;
+	uint32_t largest_record_size;
+	uint8_t data_transfer_handle_timeout;
+} __attribute__((packed));
+
+/** @struct pldm_get_pdr_repository_signature_resp
+ *
+ *  structure representing GetPDRRepositorySignature response packet
+ */
+struct pldm_get_pdr_repository_signature_resp {
+	uint8_t completion_code;
+	uint32_t repository_signature;
+} __attribute__((packed));
+
 /** @struct pldm_set_numeric_effecter_value_req
  *
  *  structure representing SetNumericEffecterValue request packet
@@ -361,6 +403,50 @@ int decode_get_pdr_req(const struct pldm_msg *msg, size_t payload_length,
 		       uint8_t *transfer_op_flag, uint16_t *request_cnt,
 		       uint16_t *record_chg_num);
 
+/* GetPDRRepositoryInfo */
+
+/** @brief Create a PLDM response message for GetPDRRepositoryInfo
+ *
+ *  @param[in] instance_id - Message's instance id
+ *  @param[in] completion_code - PLDM completion code
+ *  @param[in] repository_state - state of the PDR repository, one of
+ *        pldm_pdr_repository_state
+ *  @param[in] update_time - timestamp104 of the last update of the repository
+ *  @param[in] oem_update_time - timestamp104 of the last OEM update of the
+ *        repository
+ *  @param[in] record_count - number of PDRs in the repository
+ *  @param[in] repository_size - size of the repository in bytes
+ *  @param[in] largest_record_size - size of the largest PDR in bytes
+ *  @param[in] data_transfer_handle_timeout - data transfer handle timeout
+ *  @param[out] msg - Message will be written to this
+ *  @return pldm_completion_codes
+ *  @note  Caller is responsible for memory alloc and dealloc of param
+ *         'msg.payload'
+ */
+int encode_get_pdr_repository_info_resp(
+    uint8_t instance_id, uint8_t completion_code, uint8_t repository_state,
+    const uint8_t *update_time, const uint8_t *oem_update_time,
+    uint32_t record_count, uint32_t repository_size,
+    uint32_t largest_record_size, uint8_t data_transfer_handle_timeout,
+    struct pldm_msg *msg);
+
+/* GetPDRRepositorySignature */
+
+/** @brief Create a PLDM response message for GetPDRRepositorySignature
+ *
+ *  @param[in] instance_id - Message's instance id
+ *  @param[in] completion_code - PLDM completion code
+ *  @param[in] repository_signature - signature of the PDR repository
+ *  @param[out] msg - Message will be written to this
+ *  @return pldm_completion_codes
+ *  @note  Caller is responsible for memory alloc and dealloc of param
+ *         'msg.payload'
+ */
+int encode_get_pdr_repository_signature_resp(uint8_t instance_id,
+					     uint8_t completion_code,
+					     uint32_t repository_signature,
+					     struct pldm_msg *msg);
+
 /* GetStateSensorReadings */
 
 /** @brief Decode GetStateSensorReadings request data
@@ -461,6 +547,52 @@ int decode_get_pdr_resp(const struct pldm_msg *msg, size_t payload_length,
 			uint8_t *record_data, size_t record_data_length,
 			uint8_t *transfer_crc);
 
+/* GetPDRRepositoryInfo */
+
+/** @brief Decode GetPDRRepositoryInfo response data
+ *
+ *  Note:
+ *  * If the return value is not PLDM_SUCCESS, it represents a
+ * transport layer error.
+ *  * If the completion_code value is not PLDM_SUCCESS, it represents a
+ * protocol layer error and all the out-parameters are invalid.
+ *
+ *  @param[in] msg - Response message
+ *  @param[in] payload_length - Length of response message payload
+ *  @param[out] completion_code - PLDM completion code
+ *  @param[out] repository_state - state of the PDR repository
+ *  @param[out] update_time - timestamp104 of the last update of the
+ *        repository, PLDM_TIMESTAMP104_SIZE bytes
+ *  @param[out] oem_update_time - timestamp104 of the last OEM update of the
+ *        repository, PLDM_TIMESTAMP104_SIZE bytes
+ *  @param[out] record_count - number of PDRs in the repository
+ *  @param[out] repository_size - size of the repository in bytes
+ *  @param[out] largest_record_size - size of the largest PDR in bytes
+ *  @param[out] data_transfer_handle_timeout - data transfer handle timeout
+ *  @return pldm_completion_codes
+ */
+int decode_get_pdr_repository_info_resp(
+    const struct pldm_msg *msg, size_t payload_length,
+    uint8_t *completion_code, uint8_t *repository_state,
+    uint8_t *update_time, uint8_t *oem_update_time, uint32_t *record_count,
+    uint32_t *repository_size, uint32_t *largest_record_size,
+    uint8_t *data_transfer_handle_timeout);
+
+/* GetPDRRepositorySignature */
+
+/** @brief Decode GetPDRRepositorySignature response data
+ *
+ *  @param[in] msg - Response message
+ *  @param[in] payload_length - Length of response message payload
+ *  @param[out] completion_code - PLDM completion code
+ *  @param[out] repository_signature - signature of the PDR repository
+ *  @return pldm_completion_codes
+ */
+int decode_get_pdr_repository_signature_resp(const struct pldm_msg *msg,
+					     size_t payload_length,
+					     uint8_t *completion_code,
+					     uint32_t *repository_signature);
+
 /* SetStateEffecterStates */
 
 /** @brief Create a PLDM request message for SetStateEffecterStates
@@ -186,6 +186,43 @@ TEST(AttrTable, EnumEntryEncodeTest)
     EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
 }
 
+TEST(AttrTable, EnumEntryInfoCheckTest)
+{
+    std::vector<uint16_t> pv_hdls{2, 3};
+    std::vector<uint8_t> defs{0, 1, 1};
+
+    struct pldm_bios_table_attr_entry_enum_info info = {
+        1,              /* name handle */
+        false,          /* read only */
+        2,              /* pv number */
+        pv_hdls.data(), /* pv handle */
+        3,              /*def number */
+        defs.data()     /*def index*/
+    };
+    const char* errmsg;
+    auto rc = pldm_bios_table_attr_entry_enum_info_check(&info, &errmsg);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_STREQ("NumberOfDefaultValues should not be greater than "
+                 "NumberOfPossibleValues",
+                 errmsg);
+
+    info.def_num = 1;
+    defs[0] = 2;
+    rc = pldm_bios_table_attr_entry_enum_info_check(&info, &errmsg);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_STREQ("Wrong DefaultValueStringHandleIndex", errmsg);
+
+    std::vector<uint8_t> encodeEntry(
+        pldm_bios_table_attr_entry_enum_encode_length(2, 1), 0);
+    rc = pldm_bios_table_attr_entry_enum_encode_check(
+        encodeEntry.data(), encodeEntry.size(), &info);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    defs[0] = 1;
+    rc = pldm_bios_table_attr_entry_enum_info_check(&info, &errmsg);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+}
+
 TEST(AttrTable, StringEntryDecodeTest)
 {
     std::vector<uint8_t> stringEntry{
@@ -931,6 +968,196 @@ TEST(AttrValTable, CopyAndUpdateTest)
     EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
 }
 
+TEST(AttrValTable, UpdateInPlaceTest)
+{
+    std::vector<uint8_t> enumEntry{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        2,    /* number of current value */
+        0,    /* current value string handle index */
+        1,    /* current value string handle index */
+    };
+    std::vector<uint8_t> stringEntry{
+        1,   0,        /* attr handle */
+        1,             /* attr type */
+        3,   0,        /* current string length */
+        'a', 'b', 'c', /* defaut value string handle index */
+    };
+    std::vector<uint8_t> integerEntry{
+        2,  0,                   /* attr handle */
+        3,                       /* attr type */
+        10, 0, 0, 0, 0, 0, 0, 0, /* current value */
+    };
+    Table srcTable;
+    buildTable(srcTable, enumEntry, stringEntry, integerEntry);
+
+    auto update = [&srcTable](const std::vector<uint8_t>& entry,
+                              const Table& expectTable) {
+        Table table(srcTable);
+        table.resize(srcTable.size() + 16);
+        auto length = srcTable.size();
+        auto rc = pldm_bios_table_attr_value_update_in_place(
+            table.data(), &length, table.size(), entry.data(), entry.size());
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        table.resize(length);
+        EXPECT_THAT(table, ElementsAreArray(expectTable));
+
+        Table indexed(srcTable);
+        indexed.resize(srcTable.size() + 16);
+        length = srcTable.size();
+        auto index = pldm_bios_table_index_create(
+            indexed.data(), length, PLDM_BIOS_ATTR_VAL_TABLE);
+        ASSERT_NE(index, nullptr);
+        rc = pldm_bios_table_attr_value_update_in_place_index(
+            indexed.data(), &length, indexed.size(), index, entry.data(),
+            entry.size());
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        indexed.resize(length);
+        EXPECT_THAT(indexed, ElementsAreArray(expectTable));
+        // The index follows the entries moved by the update
+        for (uint16_t handle = 0; handle < 3; handle++)
+        {
+            EXPECT_EQ(pldm_bios_table_attr_value_find_by_handle_index(
+                          indexed.data(), indexed.size(), index, handle),
+                      pldm_bios_table_attr_value_find_by_handle(
+                          indexed.data(), indexed.size(), handle));
+        }
+        pldm_bios_table_index_free(index);
+    };
+
+    // Same size
+    std::vector<uint8_t> integerEntry1{
+        2,  0,                   /* attr handle */
+        3,                       /* attr type */
+        99, 1, 0, 0, 0, 0, 0, 0, /* current value */
+    };
+    Table expectTable;
+    buildTable(expectTable, enumEntry, stringEntry, integerEntry1);
+    update(integerEntry1, expectTable);
+
+    std::vector<uint8_t> enumEntry1{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        2,    /* number of current value */
+        1,    /* current value string handle index */
+        0,    /* current value string handle index */
+    };
+    expectTable.clear();
+    buildTable(expectTable, enumEntry1, stringEntry, integerEntry);
+    update(enumEntry1, expectTable);
+
+    // Size changes, with the pad changing too
+    std::vector<uint8_t> stringEntry1{
+        1,   0,                  /* attr handle */
+        1,                       /* attr type */
+        5,   0,                  /* current string length */
+        'd', 'e', 'f', 'a', 'b', /* defaut value string handle index */
+    };
+    expectTable.clear();
+    buildTable(expectTable, enumEntry, stringEntry1, integerEntry);
+    update(stringEntry1, expectTable);
+
+    std::vector<uint8_t> stringEntry2{
+        1,   0, /* attr handle */
+        1,      /* attr type */
+        1,   0, /* current string length */
+        'd',    /* defaut value string handle index */
+    };
+    expectTable.clear();
+    buildTable(expectTable, enumEntry, stringEntry2, integerEntry);
+    update(stringEntry2, expectTable);
+
+    std::vector<uint8_t> enumEntry2{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        1,    /* number of current value */
+        1,    /* current value string handle index */
+    };
+    expectTable.clear();
+    buildTable(expectTable, enumEntry2, stringEntry, integerEntry);
+    update(enumEntry2, expectTable);
+
+    // Errors
+    std::vector<uint8_t> stringEntry3{
+        1,   0,                                 /* attr handle */
+        1,                                      /* attr type */
+        9,   0,                                 /* current string length */
+        'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', /* current string */
+    };
+    Table table(srcTable);
+    auto length = table.size();
+    auto rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry3.data(),
+        stringEntry3.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(length, srcTable.size());
+    EXPECT_EQ(table, srcTable);
+
+    stringEntry2[2] = PLDM_BIOS_STRING_READ_ONLY;
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), stringEntry2.data(),
+        stringEntry2.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    integerEntry1[0] = 3; // no such attribute
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), integerEntry1.data(),
+        integerEntry1.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), integerEntry.data(),
+        integerEntry.size() - 1);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(table, srcTable);
+
+    std::vector<uint8_t> unknownEntry{
+        1,    0, /* attr handle */
+        0x42,    /* attr type */
+        0,    0, 0, 0,
+    };
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), unknownEntry.data(),
+        unknownEntry.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    std::vector<uint8_t> truncatedEntry{
+        1, 0, /* attr handle */
+        1,    /* attr type */
+        9,    /* first byte of the current string length */
+    };
+    rc = pldm_bios_table_attr_value_update_in_place(
+        table.data(), &length, table.size(), truncatedEntry.data(),
+        truncatedEntry.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(table, srcTable);
+
+    auto index = pldm_bios_table_index_create(table.data(), table.size(),
+                                              PLDM_BIOS_ATTR_VAL_TABLE);
+    rc = pldm_bios_table_attr_value_update_in_place_index(
+        table.data(), &length, table.size(), index, integerEntry1.data(),
+        integerEntry1.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = pldm_bios_table_attr_value_update_in_place_index(
+        table.data(), &length, table.size(), index, stringEntry2.data(),
+        stringEntry2.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = pldm_bios_table_attr_value_update_in_place_index(
+        table.data(), &length, table.size(), nullptr, enumEntry1.data(),
+        enumEntry1.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = pldm_bios_table_attr_value_update_in_place_index(
+        table.data(), &length, table.size(), index, unknownEntry.data(),
+        unknownEntry.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = pldm_bios_table_attr_value_update_in_place_index(
+        table.data(), &length, table.size(), index, truncatedEntry.data(),
+        truncatedEntry.size());
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(table, srcTable);
+    pldm_bios_table_index_free(index);
+}
+
 TEST(StringTable, EntryEncodeTest)
 {
     std::vector<uint8_t> stringEntry{
@@ -1073,6 +1300,347 @@ TEST(StringTable, FindTest)
     EXPECT_EQ(entry, nullptr);
 }
 
+TEST(TableIndex, FindTest)
+{
+    std::vector<uint8_t> stringHello{
+        1,   0,                  /* string handle*/
+        5,   0,                  /* string length */
+        'H', 'e', 'l', 'l', 'o', /* string */
+    };
+    std::vector<uint8_t> stringWorld{
+        200, 0,                       /* string handle*/
+        6,   0,                       /* string length */
+        'W', 'o', 'r', 'l', 'd', '!', /* string */
+    };
+    std::vector<uint8_t> stringHi{
+        1,   0,   /* string handle*/
+        2,   0,   /* string length */
+        'H', 'i', /* string */
+    };
+
+    Table table;
+    buildTable(table, stringHello, stringWorld, stringHi);
+
+    auto index = pldm_bios_table_index_create(table.data(), table.size(),
+                                              PLDM_BIOS_STRING_TABLE);
+    ASSERT_NE(index, nullptr);
+
+    for (uint16_t handle : {1, 200, 0, 2, 300})
+    {
+        EXPECT_EQ(pldm_bios_table_string_find_by_handle_index(
+                      table.data(), table.size(), index, handle),
+                  pldm_bios_table_string_find_by_handle(
+                      table.data(), table.size(), handle));
+    }
+
+    // The index only holds offsets, it can be used with a copy of the table
+    Table copy(table);
+    auto entry = pldm_bios_table_string_find_by_handle_index(
+        copy.data(), copy.size(), index, 200);
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(entry),
+              copy.data() + stringHello.size());
+
+    for (auto str : {"Hello", "World!", "Hi", "", "H", "Hellp", "Z"})
+    {
+        EXPECT_EQ(pldm_bios_table_string_find_by_string_index(
+                      table.data(), table.size(), index, str),
+                  pldm_bios_table_string_find_by_string(table.data(),
+                                                        table.size(), str));
+    }
+
+    // Mismatched table length or type
+    EXPECT_EQ(pldm_bios_table_string_find_by_handle_index(
+                  table.data(), table.size() - 4, index, 1),
+              nullptr);
+    EXPECT_EQ(pldm_bios_table_attr_find_by_handle_index(
+                  table.data(), table.size(), index, 1),
+              nullptr);
+    pldm_bios_table_index_free(index);
+
+    std::vector<uint8_t> enumEntry{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        1,    /* number of current value */
+        1,    /* current value string handle index */
+    };
+    std::vector<uint8_t> integerEntry{
+        3,  0,                   /* attr handle */
+        3,                       /* attr type */
+        10, 0, 0, 0, 0, 0, 0, 0, /* current value */
+    };
+    table.clear();
+    buildTable(table, enumEntry, integerEntry);
+    index = pldm_bios_table_index_create(table.data(), table.size(),
+                                         PLDM_BIOS_ATTR_VAL_TABLE);
+    ASSERT_NE(index, nullptr);
+    auto valEntry = pldm_bios_table_attr_value_find_by_handle_index(
+        table.data(), table.size(), index, 3);
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(valEntry),
+              table.data() + enumEntry.size());
+    EXPECT_EQ(pldm_bios_table_attr_value_find_by_handle_index(
+                  table.data(), table.size(), index, 1),
+              nullptr);
+    pldm_bios_table_index_free(index);
+}
+
+TEST(TableIndex, FindByStringTest)
+{
+    std::vector<std::string> strings{"A",     "AB", "Apple", "Apple",
+                                     "Apples", "B",  "Banana"};
+    Table table;
+    uint16_t handle = 0;
+    for (const auto& str : strings)
+    {
+        std::vector<uint8_t> entry(
+            pldm_bios_table_string_entry_encode_length(str.length()));
+        pldm_bios_table_string_entry_encode(entry.data(), entry.size(),
+                                            str.c_str(), str.length());
+        entry[0] = handle++;
+        table.insert(table.end(), entry.begin(), entry.end());
+    }
+    buildTable(table);
+
+    auto index = pldm_bios_table_index_create(table.data(), table.size(),
+                                              PLDM_BIOS_STRING_TABLE);
+    ASSERT_NE(index, nullptr);
+    for (const auto& str : strings)
+    {
+        auto entry = pldm_bios_table_string_find_by_string_index(
+            table.data(), table.size(), index, str.c_str());
+        ASSERT_NE(entry, nullptr);
+        EXPECT_EQ(entry, pldm_bios_table_string_find_by_string(
+                             table.data(), table.size(), str.c_str()));
+    }
+    // The first of duplicated strings is found
+    auto entry = pldm_bios_table_string_find_by_string_index(
+        table.data(), table.size(), index, "Apple");
+    EXPECT_EQ(pldm_bios_table_string_entry_decode_handle(entry), 2);
+
+    for (auto str : {"", "AA", "Appl", "C", "Bananas"})
+    {
+        EXPECT_EQ(pldm_bios_table_string_find_by_string_index(
+                      table.data(), table.size(), index, str),
+                  nullptr);
+    }
+    pldm_bios_table_index_free(index);
+}
+
+TEST(TableBuilder, StringTableTest)
+{
+    std::vector<uint8_t> stringHello{
+        0,   0,                  /* string handle*/
+        5,   0,                  /* string length */
+        'H', 'e', 'l', 'l', 'o', /* string */
+    };
+    std::vector<uint8_t> stringHi{
+        1,   0,   /* string handle*/
+        2,   0,   /* string length */
+        'H', 'i', /* string */
+    };
+    Table expected;
+    buildTable(expected, stringHello, stringHi);
+
+    // Tables built by different builders don't depend on each other
+    for (int i = 0; i < 2; i++)
+    {
+        Table table(expected.size());
+        struct pldm_bios_table_builder builder;
+        pldm_bios_table_builder_init(&builder, table.data(), table.size());
+        uint16_t handle = 0xffff;
+        auto rc = pldm_bios_table_builder_string_add(&builder, "Hello", 5,
+                                                     &handle);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(handle, 0);
+        rc = pldm_bios_table_builder_string_add(&builder, "Hi", 2, &handle);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(handle, 1);
+        size_t length = 0;
+        rc = pldm_bios_table_builder_finish(&builder, &length);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(length, expected.size());
+        EXPECT_EQ(table, expected);
+    }
+
+    // The buffer can be grown while building
+    Table table(stringHello.size());
+    struct pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, table.data(), table.size());
+    EXPECT_EQ(pldm_bios_table_builder_string_add(&builder, "Hello", 5, NULL),
+              PLDM_SUCCESS);
+    table.resize(expected.size());
+    pldm_bios_table_builder_set_buffer(&builder, table.data(), table.size());
+    EXPECT_EQ(pldm_bios_table_builder_string_add(&builder, "Hi", 2, NULL),
+              PLDM_SUCCESS);
+    size_t length = 0;
+    EXPECT_EQ(pldm_bios_table_builder_finish(&builder, &length), PLDM_SUCCESS);
+    EXPECT_EQ(table, expected);
+}
+
+TEST(TableBuilder, SizingTest)
+{
+    struct pldm_bios_table_attr_entry_integer_info integerInfo = {
+        1,     /* name handle */
+        false, /* read only */
+        1,     /* lower bound */
+        10,    /* upper bound */
+        2,     /* scalar increment */
+        3,     /* default value */
+    };
+    struct pldm_bios_table_attr_entry_string_info stringInfo = {
+        2,     /* name handle */
+        false, /* read only */
+        1,     /* string type ascii */
+        1,     /* min length */
+        100,   /* max length */
+        3,     /* default length */
+        "abc", /* default string */
+    };
+
+    auto build = [&](struct pldm_bios_table_builder& builder) {
+        uint16_t handle = 0xffff;
+        auto rc = pldm_bios_table_builder_attr_integer_add(
+            &builder, &integerInfo, &handle);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(handle, 0);
+        rc = pldm_bios_table_builder_attr_string_add(&builder, &stringInfo,
+                                                     &handle);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(handle, 1);
+        size_t length = 0;
+        rc = pldm_bios_table_builder_finish(&builder, &length);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        return length;
+    };
+
+    struct pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, NULL, 0);
+    auto size = build(builder);
+    auto entriesLength = pldm_bios_table_attr_entry_integer_encode_length() +
+                         pldm_bios_table_attr_entry_string_encode_length(3);
+    EXPECT_EQ(size, entriesLength +
+                        pldm_bios_table_pad_checksum_size(entriesLength));
+
+    Table table(size);
+    pldm_bios_table_builder_init(&builder, table.data(), table.size());
+    EXPECT_EQ(build(builder), size);
+    auto entry = pldm_bios_table_attr_find_by_handle(table.data(),
+                                                     table.size(), 1);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->attr_type, PLDM_BIOS_STRING);
+
+    // Sizing checks the entries too
+    pldm_bios_table_builder_init(&builder, NULL, 0);
+    integerInfo.default_value = 4;
+    auto rc =
+        pldm_bios_table_builder_attr_integer_add(&builder, &integerInfo, NULL);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    size_t length = 0;
+    rc = pldm_bios_table_builder_finish(&builder, &length);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+}
+
+TEST(TableBuilder, ErrorTest)
+{
+    Table table(64);
+    struct pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, table.data(), table.size());
+
+    struct pldm_bios_table_attr_entry_integer_info info = {
+        1,     /* name handle */
+        false, /* read only */
+        1,     /* lower bound */
+        10,    /* upper bound */
+        2,     /* scalar increment */
+        4,     /* default value */
+    };
+    auto rc = pldm_bios_table_builder_attr_integer_add(&builder, &info, NULL);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_STREQ(pldm_bios_table_builder_errmsg(&builder),
+                 "Wrong DefaultValue or ScalarIncrement");
+
+    // The first error is kept
+    info.default_value = 3;
+    rc = pldm_bios_table_builder_attr_integer_add(&builder, &info, NULL);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    size_t length = 0;
+    rc = pldm_bios_table_builder_finish(&builder, &length);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    auto entryLength = pldm_bios_table_attr_entry_integer_encode_length();
+    pldm_bios_table_builder_init(&builder, table.data(), entryLength);
+    uint16_t handle = 0xffff;
+    rc = pldm_bios_table_builder_attr_integer_add(&builder, &info, &handle);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(handle, 0);
+    rc = pldm_bios_table_builder_attr_integer_add(&builder, &info, &handle);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(handle, 0);
+
+    pldm_bios_table_builder_init(&builder, table.data(), entryLength);
+    rc = pldm_bios_table_builder_attr_integer_add(&builder, &info, &handle);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    rc = pldm_bios_table_builder_finish(&builder, &length);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+
+    std::vector<uint16_t> pvHandles{2, 3};
+    std::vector<uint8_t> defIndices{2};
+    struct pldm_bios_table_attr_entry_enum_info enumInfo = {
+        1,                 /* name handle */
+        false,             /* read only */
+        2,                 /* pv number */
+        pvHandles.data(),  /* pv handle */
+        1,                 /* def number */
+        defIndices.data(), /* def index */
+    };
+    pldm_bios_table_builder_init(&builder, table.data(), table.size());
+    rc = pldm_bios_table_builder_attr_enum_add(&builder, &enumInfo, &handle);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_STREQ(pldm_bios_table_builder_errmsg(&builder),
+                 "Wrong DefaultValueStringHandleIndex");
+    rc = pldm_bios_table_builder_finish(&builder, &length);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+}
+
+TEST(Iterator, InitTest)
+{
+    std::vector<uint8_t> stringHello{
+        0,   0,                  /* string handle*/
+        5,   0,                  /* string length */
+        'H', 'e', 'l', 'l', 'o', /* string */
+    };
+    Table table;
+    buildTable(table, stringHello);
+
+    pldm_bios_table_iter iter;
+    auto rc = pldm_bios_table_iter_init(&iter, table.data(), table.size(),
+                                        PLDM_BIOS_STRING_TABLE);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    auto entry = pldm_bios_table_iter_string_entry_value(&iter);
+    EXPECT_EQ(std::memcmp(entry, stringHello.data(), stringHello.size()), 0);
+    pldm_bios_table_iter_next(&iter);
+    EXPECT_TRUE(pldm_bios_table_iter_is_end(&iter));
+
+    rc = pldm_bios_table_iter_init(nullptr, table.data(), table.size(),
+                                   PLDM_BIOS_STRING_TABLE);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    auto badType = static_cast<pldm_bios_table_types>(3);
+    rc = pldm_bios_table_iter_init(&iter, table.data(), table.size(), badType);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(pldm_bios_table_iter_create(table.data(), table.size(), badType),
+              nullptr);
+
+    /* An entry overrunning the table ends the iteration */
+    stringHello[2] = 200;
+    table.clear();
+    buildTable(table, stringHello, stringHello);
+    rc = pldm_bios_table_iter_init(&iter, table.data(), table.size(),
+                                   PLDM_BIOS_STRING_TABLE);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_FALSE(pldm_bios_table_iter_is_end(&iter));
+    pldm_bios_table_iter_next(&iter);
+    EXPECT_TRUE(pldm_bios_table_iter_is_end(&iter));
+}
+
 TEST(Itearator, DeathTest)
 {
 
@@ -1109,3 +1677,133 @@ TEST(PadAndChecksum, PadAndChecksum)
                            0x66, 0x00, 0x6d, 0x81, 0x4a, 0xb6};
     EXPECT_EQ(attrValTable, expectedTable);
 }
+
+TEST(TableValidation, ValidateTest)
+{
+    std::vector<uint8_t> stringName{
+        1,   0,          /* string handle */
+        3,   0,          /* string length */
+        'A', 'B', 'C',   /* string */
+    };
+    std::vector<uint8_t> stringOn{
+        2,   0,          /* string handle */
+        2,   0,          /* string length */
+        'o', 'n',        /* string */
+    };
+    std::vector<uint8_t> stringOff{
+        3,   0,          /* string handle */
+        3,   0,          /* string length */
+        'o', 'f', 'f',   /* string */
+    };
+    std::vector<uint8_t> enumEntry{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        1, 0, /* attr name handle (string handle) */
+        2,    /* number of possible value */
+        2, 0, /* possible value handle */
+        3, 0, /* possible value handle */
+        1,    /* number of default value */
+        0     /* defaut value string handle index */
+    };
+    std::vector<uint8_t> enumValueEntry{
+        0, 0, /* attr handle */
+        0,    /* attr type */
+        1,    /* number of current value */
+        1     /* current value string handle index */
+    };
+
+    Table stringTable;
+    buildTable(stringTable, stringName, stringOn, stringOff);
+    Table attrTable;
+    buildTable(attrTable, enumEntry);
+    Table attrValueTable;
+    buildTable(attrValueTable, enumValueEntry);
+
+    pldm_bios_table_validation report;
+    auto rc =
+        pldm_bios_table_validate(stringTable.data(), stringTable.size(),
+                                 PLDM_BIOS_STRING_TABLE, NULL, 0, &report);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_NO_DEFECT);
+    EXPECT_EQ(report.entries, 3);
+    rc = pldm_bios_table_validate(attrTable.data(), attrTable.size(),
+                                  PLDM_BIOS_ATTR_TABLE, stringTable.data(),
+                                  stringTable.size(), &report);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(report.entries, 1);
+    rc = pldm_bios_table_validate(
+        attrValueTable.data(), attrValueTable.size(), PLDM_BIOS_ATTR_VAL_TABLE,
+        attrTable.data(), attrTable.size(), &report);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    auto validate = [&report](const Table& table, pldm_bios_table_types type,
+                              const Table& refTable = {}) {
+        return pldm_bios_table_validate(
+            table.data(), table.size(), type,
+            refTable.empty() ? NULL : refTable.data(), refTable.size(),
+            &report);
+    };
+
+    /* The table ends in the middle of an entry */
+    Table table(stringTable.begin(), stringTable.begin() + 16);
+    EXPECT_EQ(validate(table, PLDM_BIOS_STRING_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_TRUNCATED);
+    EXPECT_EQ(report.offset, stringName.size());
+    EXPECT_EQ(report.entries, 1);
+
+    /* An entry length overruns the table */
+    table = stringTable;
+    table[9] = 0xff;
+    EXPECT_EQ(validate(table, PLDM_BIOS_STRING_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_TRUNCATED);
+
+    table.clear();
+    buildTable(table, stringName, stringOn, stringName);
+    EXPECT_EQ(validate(table, PLDM_BIOS_STRING_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_DUPLICATE_HANDLE);
+    EXPECT_EQ(report.offset, stringName.size() + stringOn.size());
+    EXPECT_EQ(report.handle, 1);
+
+    /* A possible value refers to a string that doesn't exist */
+    table.clear();
+    buildTable(table, stringName, stringOn);
+    EXPECT_EQ(validate(attrTable, PLDM_BIOS_ATTR_TABLE, table),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_DANGLING_HANDLE);
+    EXPECT_EQ(report.offset, 0);
+    EXPECT_EQ(report.handle, 3);
+
+    table = attrTable;
+    table[2] = PLDM_BIOS_ENUMERATION_READ_ONLY;
+    EXPECT_EQ(validate(attrValueTable, PLDM_BIOS_ATTR_VAL_TABLE, table),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_ATTR_TYPE_MISMATCH);
+    EXPECT_EQ(report.handle, 0);
+
+    table = attrTable;
+    table[2] = PLDM_BIOS_PASSWORD;
+    EXPECT_EQ(validate(table, PLDM_BIOS_ATTR_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_UNKNOWN_ATTR_TYPE);
+
+    table = attrValueTable;
+    table[enumValueEntry.size()] = 1;
+    EXPECT_EQ(validate(table, PLDM_BIOS_ATTR_VAL_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_BAD_PAD);
+    EXPECT_EQ(report.offset, enumValueEntry.size());
+
+    table = stringTable;
+    table.back() ^= 1;
+    EXPECT_EQ(validate(table, PLDM_BIOS_STRING_TABLE),
+              PLDM_ERROR_INVALID_DATA);
+    EXPECT_EQ(report.defect, PLDM_BIOS_TABLE_BAD_CHECKSUM);
+    EXPECT_EQ(report.offset, table.size() - 4);
+
+    EXPECT_EQ(pldm_bios_table_validate(NULL, 0, PLDM_BIOS_STRING_TABLE, NULL,
+                                       0, NULL),
+              PLDM_ERROR_INVALID_DATA);
+}
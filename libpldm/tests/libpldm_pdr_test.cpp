@@ -1,4 +1,5 @@
 #include <array>
+#include <vector>
 
 #include "libpldm/pdr.h"
 #include "libpldm/platform.h"
@@ -35,6 +36,42 @@ TEST(PDRUpdate, testAdd)
     pldm_pdr_destroy(repo);
 }
 
+TEST(PDRUpdate, testAddInPlace)
+{
+    auto repo = pldm_pdr_init();
+
+    uint8_t* data = nullptr;
+    auto handle = pldm_pdr_add_in_place(repo, sizeof(pldm_pdr_hdr) + 4, 0,
+                                        &data);
+    EXPECT_EQ(handle, 1);
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 1);
+    EXPECT_EQ(pldm_pdr_get_repo_size(repo), sizeof(pldm_pdr_hdr) + 4);
+    auto hdr = reinterpret_cast<pldm_pdr_hdr*>(data);
+    EXPECT_EQ(hdr->record_handle, 1);
+    EXPECT_EQ(hdr->type, 0);
+    hdr->type = PLDM_STATE_EFFECTER_PDR;
+    data[sizeof(pldm_pdr_hdr)] = 0xab;
+
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    uint8_t* outData = nullptr;
+    auto hdl = pldm_pdr_find_record(repo, 1, &outData, &size, &nextRecHdl);
+    EXPECT_NE(hdl, nullptr);
+    EXPECT_EQ(outData, data);
+    EXPECT_EQ(size, sizeof(pldm_pdr_hdr) + 4);
+    EXPECT_EQ(reinterpret_cast<pldm_pdr_hdr*>(outData)->type,
+              PLDM_STATE_EFFECTER_PDR);
+    EXPECT_EQ(outData[sizeof(pldm_pdr_hdr)], 0xab);
+
+    handle = pldm_pdr_add_in_place(repo, sizeof(pldm_pdr_hdr), 0x10, &data);
+    EXPECT_EQ(handle, 0x10);
+    EXPECT_EQ(reinterpret_cast<pldm_pdr_hdr*>(data)->record_handle, 0);
+    EXPECT_EQ(pldm_pdr_get_record_count(repo), 2);
+
+    pldm_pdr_destroy(repo);
+}
+
 TEST(PDRAccess, testGet)
 {
     auto repo = pldm_pdr_init();
@@ -318,3 +355,210 @@ TEST(PDRUpdate, tesFindtFruRecordSet)
 
     pldm_pdr_destroy(repo);
 }
+
+TEST(PDRImage, testSerializeDeserialize)
+{
+    auto repo = pldm_pdr_init();
+
+    std::array<uint32_t, 10> in{100, 345, 3, 6, 89, 0, 11, 45, 23434, 123123};
+    std::array<uint32_t, 5> in2{1000, 3450, 30, 60, 890};
+    pldm_pdr_add(repo, reinterpret_cast<uint8_t*>(in.data()), sizeof(in), 1);
+    pldm_pdr_add(repo, reinterpret_cast<uint8_t*>(in2.data()), sizeof(in2),
+                 7);
+    pldm_pdr_add_fru_record_set(repo, 1, 10, 1, 0, 100);
+
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    EXPECT_EQ(pldm_pdr_serialize(repo, image.data(), image.size() - 1),
+              PLDM_ERROR_INVALID_LENGTH);
+    EXPECT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+
+    auto copy = pldm_pdr_deserialize(image.data(), image.size());
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(pldm_pdr_get_record_count(copy), 3);
+    EXPECT_EQ(pldm_pdr_get_repo_size(copy), pldm_pdr_get_repo_size(repo));
+
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    uint8_t* outData = nullptr;
+    auto hdl = pldm_pdr_find_record(copy, 7, &outData, &size, &nextRecHdl);
+    EXPECT_NE(hdl, nullptr);
+    EXPECT_EQ(size, sizeof(in2));
+    EXPECT_EQ(nextRecHdl, 8);
+    EXPECT_EQ(memcmp(outData, in2.data(), sizeof(in2)), 0);
+
+    // New records continue the handle sequence of the serialized repo
+    EXPECT_EQ(pldm_pdr_add_fru_record_set(copy, 2, 11, 2, 1, 101), 9);
+
+    pldm_pdr_destroy(copy);
+    pldm_pdr_destroy(repo);
+}
+
+TEST(PDRImage, testAttach)
+{
+    auto repo = pldm_pdr_init();
+
+    std::array<uint32_t, 10> in{100, 345, 3, 6, 89, 0, 11, 45, 23434, 123123};
+    pldm_pdr_add(repo, reinterpret_cast<uint8_t*>(in.data()), sizeof(in), 1);
+    pldm_pdr_add(repo, reinterpret_cast<uint8_t*>(in.data()), sizeof(in), 2);
+
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    ASSERT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+    pldm_pdr_destroy(repo);
+
+    auto attached = pldm_pdr_attach_image(image.data(), image.size());
+    ASSERT_NE(attached, nullptr);
+    EXPECT_EQ(pldm_pdr_get_record_count(attached), 2);
+    EXPECT_EQ(pldm_pdr_get_repo_size(attached), sizeof(in) * 2);
+
+    uint32_t size{};
+    uint32_t nextRecHdl{};
+    uint8_t* outData = nullptr;
+    auto hdl = pldm_pdr_find_record(attached, 0, &outData, &size, &nextRecHdl);
+    EXPECT_NE(hdl, nullptr);
+    EXPECT_EQ(size, sizeof(in));
+    EXPECT_EQ(nextRecHdl, 2);
+    EXPECT_EQ(memcmp(outData, in.data(), sizeof(in)), 0);
+    // Record data is referenced in place
+    EXPECT_GE(outData, image.data());
+    EXPECT_LT(outData, image.data() + image.size());
+
+    hdl = pldm_pdr_get_next_record(attached, hdl, &outData, &size, &nextRecHdl);
+    EXPECT_NE(hdl, nullptr);
+    EXPECT_EQ(pldm_pdr_get_record_handle(attached, hdl), 2);
+    EXPECT_EQ(nextRecHdl, 0);
+
+    // Records added after attaching are owned by the repo
+    EXPECT_EQ(pldm_pdr_add(attached, reinterpret_cast<uint8_t*>(in.data()),
+                           sizeof(in), 0),
+              3);
+    EXPECT_EQ(pldm_pdr_get_record_count(attached), 3);
+
+    pldm_pdr_destroy(attached);
+}
+
+TEST(PDRImage, testBadImage)
+{
+    auto repo = pldm_pdr_init();
+
+    std::array<uint8_t, 10> data{};
+    pldm_pdr_add(repo, data.data(), data.size(), 0);
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    ASSERT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+    pldm_pdr_destroy(repo);
+
+    EXPECT_EQ(pldm_pdr_deserialize(image.data(), image.size() - 1), nullptr);
+    EXPECT_EQ(pldm_pdr_attach_image(image.data(), 4), nullptr);
+
+    image.back() ^= 0xff;
+    EXPECT_EQ(pldm_pdr_deserialize(image.data(), image.size()), nullptr);
+    EXPECT_EQ(pldm_pdr_attach_image(image.data(), image.size()), nullptr);
+    image.back() ^= 0xff;
+
+    image[0] = 'X';
+    EXPECT_EQ(pldm_pdr_attach_image(image.data(), image.size()), nullptr);
+}
+
+TEST(PDRImage, testDuplicateHandles)
+{
+    auto repo = pldm_pdr_init();
+
+    std::array<uint8_t, 10> data{};
+    pldm_pdr_add(repo, data.data(), data.size(), 1);
+    pldm_pdr_add(repo, data.data(), data.size(), 2);
+    pldm_pdr_add(repo, data.data(), data.size(), 1);
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    ASSERT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+    pldm_pdr_destroy(repo);
+
+    EXPECT_EQ(pldm_pdr_deserialize(image.data(), image.size()), nullptr);
+    EXPECT_EQ(pldm_pdr_attach_image(image.data(), image.size()), nullptr);
+}
+
+TEST(PDRImage, testEmptyRepo)
+{
+    auto repo = pldm_pdr_init();
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    ASSERT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+    pldm_pdr_destroy(repo);
+
+    auto attached = pldm_pdr_attach_image(image.data(), image.size());
+    ASSERT_NE(attached, nullptr);
+    EXPECT_EQ(pldm_pdr_get_record_count(attached), 0);
+    EXPECT_EQ(pldm_pdr_get_repo_size(attached), 0);
+    pldm_pdr_destroy(attached);
+}
+
+TEST(PDRAccess, testLargestRecordAndSignature)
+{
+    auto repo = pldm_pdr_init();
+    EXPECT_EQ(pldm_pdr_get_largest_record_size(repo), 0);
+    EXPECT_EQ(pldm_pdr_get_signature(repo), 0);
+
+    std::array<uint8_t, 20> data{};
+    pldm_pdr_add(repo, data.data(), 12, 0);
+    auto sig1 = pldm_pdr_get_signature(repo);
+    EXPECT_NE(sig1, 0);
+    EXPECT_EQ(pldm_pdr_get_signature(repo), sig1);
+    pldm_pdr_add(repo, data.data(), data.size(), 0);
+    pldm_pdr_add(repo, data.data(), 15, 0);
+    EXPECT_EQ(pldm_pdr_get_largest_record_size(repo), data.size());
+    auto sig2 = pldm_pdr_get_signature(repo);
+    EXPECT_NE(sig2, sig1);
+
+    // Same records give the same signature, however it is computed
+    auto other = pldm_pdr_init();
+    pldm_pdr_add(other, data.data(), 12, 0);
+    pldm_pdr_add(other, data.data(), data.size(), 0);
+    uint8_t* inPlace = nullptr;
+    pldm_pdr_add_in_place(other, 15, 0, &inPlace);
+    EXPECT_EQ(pldm_pdr_get_signature(other), sig2);
+    pldm_pdr_destroy(other);
+
+    std::vector<uint8_t> image(pldm_pdr_get_image_size(repo));
+    ASSERT_EQ(pldm_pdr_serialize(repo, image.data(), image.size()),
+              PLDM_SUCCESS);
+    auto attached = pldm_pdr_attach_image(image.data(), image.size());
+    ASSERT_NE(attached, nullptr);
+    EXPECT_EQ(pldm_pdr_get_signature(attached), sig2);
+    EXPECT_EQ(pldm_pdr_get_largest_record_size(attached), data.size());
+    pldm_pdr_destroy(attached);
+
+    // Different data gives a different signature
+    other = pldm_pdr_init();
+    pldm_pdr_add(other, data.data(), 12, 0);
+    pldm_pdr_add(other, data.data(), data.size(), 0);
+    pldm_pdr_add_in_place(other, 15, 0, &inPlace);
+    inPlace[sizeof(pldm_pdr_hdr)] = 1;
+    auto sig3 = pldm_pdr_get_signature(other);
+    EXPECT_NE(sig3, sig2);
+
+    // A record added in place is signed with its final contents once the
+    // next record is added
+    pldm_pdr_add(other, data.data(), 12, 0);
+    const pldm_pdr* constOther = other;
+    auto sig4 = pldm_pdr_get_signature(constOther);
+    EXPECT_NE(sig4, sig3);
+    auto copy = pldm_pdr_init();
+    uint8_t* recordData = nullptr;
+    uint32_t recordSize{};
+    uint32_t nextHandle{};
+    auto record = pldm_pdr_find_record(other, 0, &recordData, &recordSize,
+                                       &nextHandle);
+    while (record)
+    {
+        pldm_pdr_add(copy, recordData, recordSize,
+                     pldm_pdr_get_record_handle(other, record));
+        record = pldm_pdr_get_next_record(other, record, &recordData,
+                                          &recordSize, &nextHandle);
+    }
+    EXPECT_EQ(pldm_pdr_get_signature(copy), sig4);
+    pldm_pdr_destroy(copy);
+    pldm_pdr_destroy(other);
+
+    pldm_pdr_destroy(repo);
+}
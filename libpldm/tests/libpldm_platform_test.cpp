@@ -766,3 +766,107 @@ TEST(GetStateSensorReadings, testBadDecodeRequest)
 
     EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
 }
+
+TEST(GetPDRRepositoryInfo, testGoodEncodeDecodeResponse)
+{
+    std::array<uint8_t, hdrSize + PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES>
+        responseMsg{};
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime{};
+    updateTime[7] = 30;
+    oemUpdateTime[12] = 0x60;
+
+    auto rc = encode_get_pdr_repository_info_resp(
+        0, PLDM_SUCCESS, PLDM_PDR_REPOSITORY_AVAILABLE, updateTime.data(),
+        oemUpdateTime.data(), 5, 120, 40, 0, response);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(response->hdr.command, PLDM_GET_PDR_REPOSITORY_INFO);
+
+    uint8_t completionCode{};
+    uint8_t repositoryState{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> retUpdateTime{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> retOemUpdateTime{};
+    uint32_t recordCount{};
+    uint32_t repositorySize{};
+    uint32_t largestRecordSize{};
+    uint8_t timeout{};
+    rc = decode_get_pdr_repository_info_resp(
+        response, responseMsg.size() - hdrSize, &completionCode,
+        &repositoryState, retUpdateTime.data(), retOemUpdateTime.data(),
+        &recordCount, &repositorySize, &largestRecordSize, &timeout);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(completionCode, PLDM_SUCCESS);
+    EXPECT_EQ(repositoryState, PLDM_PDR_REPOSITORY_AVAILABLE);
+    EXPECT_EQ(retUpdateTime, updateTime);
+    EXPECT_EQ(retOemUpdateTime, oemUpdateTime);
+    EXPECT_EQ(recordCount, 5);
+    EXPECT_EQ(repositorySize, 120);
+    EXPECT_EQ(largestRecordSize, 40);
+    EXPECT_EQ(timeout, 0);
+}
+
+TEST(GetPDRRepositoryInfo, testBadEncodeDecodeResponse)
+{
+    std::array<uint8_t, hdrSize + PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES>
+        responseMsg{};
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> time{};
+
+    auto rc = encode_get_pdr_repository_info_resp(
+        0, PLDM_SUCCESS, PLDM_PDR_REPOSITORY_AVAILABLE, time.data(),
+        time.data(), 0, 0, 0, 0, nullptr);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+    rc = encode_get_pdr_repository_info_resp(
+        0, PLDM_SUCCESS, PLDM_PDR_REPOSITORY_AVAILABLE, nullptr, time.data(),
+        0, 0, 0, 0, response);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+
+    rc = encode_get_pdr_repository_info_resp(
+        0, PLDM_SUCCESS, PLDM_PDR_REPOSITORY_AVAILABLE, time.data(),
+        time.data(), 0, 0, 0, 0, response);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+
+    uint8_t completionCode{};
+    uint8_t repositoryState{};
+    uint32_t recordCount{};
+    uint32_t repositorySize{};
+    uint32_t largestRecordSize{};
+    uint8_t timeout{};
+    rc = decode_get_pdr_repository_info_resp(
+        response, responseMsg.size() - hdrSize - 1, &completionCode,
+        &repositoryState, time.data(), time.data(), &recordCount,
+        &repositorySize, &largestRecordSize, &timeout);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+    rc = decode_get_pdr_repository_info_resp(
+        response, responseMsg.size() - hdrSize, &completionCode, nullptr,
+        time.data(), time.data(), &recordCount, &repositorySize,
+        &largestRecordSize, &timeout);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_DATA);
+}
+
+TEST(GetPDRRepositorySignature, testEncodeDecodeResponse)
+{
+    std::array<uint8_t, hdrSize + PLDM_GET_PDR_REPOSITORY_SIGNATURE_RESP_BYTES>
+        responseMsg{};
+    auto response = reinterpret_cast<pldm_msg*>(responseMsg.data());
+
+    auto rc = encode_get_pdr_repository_signature_resp(0, PLDM_SUCCESS,
+                                                       0xdeadbeef, response);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(response->hdr.command, PLDM_GET_PDR_REPOSITORY_SIGNATURE);
+
+    uint8_t completionCode{};
+    uint32_t signature{};
+    rc = decode_get_pdr_repository_signature_resp(
+        response, responseMsg.size() - hdrSize, &completionCode, &signature);
+    EXPECT_EQ(rc, PLDM_SUCCESS);
+    EXPECT_EQ(completionCode, PLDM_SUCCESS);
+    EXPECT_EQ(signature, 0xdeadbeef);
+
+    rc = decode_get_pdr_repository_signature_resp(
+        response, responseMsg.size() - hdrSize - 1, &completionCode,
+        &signature);
+    EXPECT_EQ(rc, PLDM_ERROR_INVALID_LENGTH);
+}
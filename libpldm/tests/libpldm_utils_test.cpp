@@ -1,6 +1,10 @@
+#include <algorithm>
 #include <cstring>
+#include <random>
+#include <string>
 #include <vector>
 
+#include "libpldm/crc32_impl.h"
 #include "libpldm/utils.h"
 
 #include <gtest/gtest.h>
@@ -12,6 +16,97 @@ TEST(Crc32, CheckSumTest)
     EXPECT_EQ(checksum, 0xcbf43926);
 }
 
+TEST(Crc32, EquivalenceTest)
+{
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<unsigned> byte(0, 0xff);
+    std::vector<uint8_t> buffer(4096 + 16);
+    std::generate(buffer.begin(), buffer.end(), [&]() { return byte(gen); });
+
+    std::vector<crc32_impl> impls;
+    for (auto impl : {CRC32_IMPL_SLICE8, CRC32_IMPL_ARMV8, CRC32_IMPL_PCLMUL})
+    {
+        if (crc32_impl_supported(impl))
+        {
+            impls.push_back(impl);
+        }
+    }
+    ASSERT_EQ(impls.front(), CRC32_IMPL_SLICE8);
+
+    // Bit at a time reference, extended one byte at a time, against which
+    // the sliced and hardware assisted implementations must agree for any
+    // length and alignment
+    for (size_t offset = 0; offset < 16; offset++)
+    {
+        const uint8_t* data = buffer.data() + offset;
+        uint32_t reference = ~0U;
+        for (size_t size = 0; size <= 4096; size++)
+        {
+            for (auto impl : impls)
+            {
+                ASSERT_EQ(crc32_impl_update(impl, 0, data, size), ~reference)
+                    << "impl " << impl << " size " << size << " offset "
+                    << offset;
+            }
+            if (size < 300)
+            {
+                // crc32() runs whichever implementation is the best here
+                ASSERT_EQ(crc32(data, size), ~reference);
+            }
+            reference ^= data[size];
+            for (int bit = 0; bit < 8; bit++)
+            {
+                reference = (reference >> 1) ^ (reference & 1 ? 0xedb88320 : 0);
+            }
+        }
+    }
+}
+
+TEST(Crc32, CombineTest)
+{
+    const char data[] = "123456789abcdefghijklmnopqrstuvwxyz";
+    auto size = sizeof(data) - 1;
+    auto checksum = crc32(data, size);
+
+    for (size_t i = 0; i <= size; i++)
+    {
+        auto prefix = crc32(data, i);
+        auto suffix = crc32(data + i, size - i);
+        EXPECT_EQ(crc32_combine(prefix, suffix, size - i), checksum);
+        EXPECT_EQ(crc32_prefix(checksum, suffix, size - i), prefix);
+    }
+}
+
+TEST(Crc32, UpdateTest)
+{
+    const char data[] = "123456789abcdefghijklmnopqrstuvwxyz";
+    auto size = sizeof(data) - 1;
+    auto checksum = crc32(data, size);
+
+    for (size_t i = 0; i <= size; i++)
+    {
+        auto crc = crc32_update(0, data, i);
+        EXPECT_EQ(crc32_update(crc, data + i, size - i), checksum);
+    }
+}
+
+TEST(Crc32, PatchTest)
+{
+    std::string data = "123456789abcdefghijklmnopqrstuvwxyz";
+    const std::string patch = "ABCDE";
+
+    for (size_t i = 0; i + patch.size() <= data.size(); i++)
+    {
+        auto patched = data;
+        patched.replace(i, patch.size(), patch);
+        auto checksum = crc32_patch(crc32(data.data(), data.size()),
+                                    data.data() + i, patch.data(),
+                                    patch.size(),
+                                    data.size() - i - patch.size());
+        EXPECT_EQ(checksum, crc32(patched.data(), patched.size()));
+    }
+}
+
 TEST(Crc8, CheckSumTest)
 {
     const char* data = "123456789";
@@ -35,6 +35,50 @@ uint8_t crc8(const void *data, size_t size);
  */
 uint32_t crc32(const void *data, size_t size);
 
+/** @brief Continue a Crc32 over more data
+ *
+ *  crc32_update(crc32(a, a_size), b, b_size) is the Crc32 of a followed by b,
+ *  and crc32_update(0, data, size) is crc32(data, size).
+ *
+ *  @param[in] crc - Crc32 of the data so far, 0 if there is none
+ *  @param[in] data - Pointer to the data following it
+ *  @param[in] size - Size of the data
+ *  @return The checksum of all the data
+ */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t size);
+
+/** @brief Compute the Crc32 of the concatenation of two blocks of data
+ *
+ *  @param[in] crc1 - Crc32 of the first block
+ *  @param[in] crc2 - Crc32 of the second block
+ *  @param[in] len2 - Size of the second block
+ *  @return The checksum of the first block followed by the second block
+ */
+uint32_t crc32_combine(uint32_t crc1, uint32_t crc2, size_t len2);
+
+/** @brief Compute the Crc32 of the leading part of data, from the Crc32 of the
+ *         whole data and the Crc32 of the rest of the data
+ *
+ *  @param[in] crc - Crc32 of the whole data
+ *  @param[in] suffix_crc - Crc32 of the rest of the data, after the prefix
+ *  @param[in] suffix_len - Size of the rest of the data
+ *  @return The checksum of the prefix
+ */
+uint32_t crc32_prefix(uint32_t crc, uint32_t suffix_crc, size_t suffix_len);
+
+/** @brief Update the Crc32 of data after changing a range of it, without
+ *         reading the rest of the data
+ *
+ *  @param[in] crc - Crc32 of the data before the change
+ *  @param[in] old_data - Pointer to the range before the change
+ *  @param[in] new_data - Pointer to the range after the change
+ *  @param[in] size - Size of the range
+ *  @param[in] tail_size - Size of the data after the range
+ *  @return The checksum of the data after the change
+ */
+uint32_t crc32_patch(uint32_t crc, const void *old_data, const void *new_data,
+		     size_t size, size_t tail_size);
+
 /** @brief Convert ver32_t to string
  *  @param[in] version - Pointer to ver32_t
  *  @param[out] buffer - Pointer to the buffer
@@ -6,6 +6,7 @@
 #include <time.h>
 
 #include <array>
+#include <atomic>
 #include <boost/crc.hpp>
 #include <chrono>
 #include <ctime>
@@ -18,13 +19,24 @@
 #include <variant>
 #include <vector>
 
+#include "libpldm/utils.h"
+
 namespace fs = std::filesystem;
 using namespace pldm::responder::bios;
 using namespace bios_parser;
+using pldm::bios::utils::AttrEntryView;
+using pldm::bios::utils::BIOSTableIter;
+using pldm::bios::utils::PackedSpan;
 
 constexpr auto stringTableFile = "stringTable";
 constexpr auto attrTableFile = "attributeTable";
 constexpr auto attrValTableFile = "attributeValueTable";
+// Identifies the configuration the persisted tables were built from
+constexpr auto tablesConfigFile = "tablesConfig";
+// Bump when the persisted tables change format
+constexpr uint32_t tablesFormatVersion = 1;
+// Attribute value changes journaled before the table file is rewritten
+constexpr size_t journalCompactThreshold = 64;
 
 namespace pldm
 {
@@ -84,34 +96,39 @@ size_t getTableTotalsize(size_t sizeWithoutPad)
     return sizeWithoutPad + pldm_bios_table_pad_checksum_size(sizeWithoutPad);
 }
 
-void padAndChecksum(Table& table)
-{
-    auto sizeWithoutPad = table.size();
-    auto padAndChecksumSize = pldm_bios_table_pad_checksum_size(sizeWithoutPad);
-    table.resize(table.size() + padAndChecksumSize);
-
-    pldm_bios_table_append_pad_checksum(table.data(), table.size(),
-                                        sizeWithoutPad);
-}
-
 } // namespace utils
 
 namespace bios
 {
 
-Handler::Handler()
+Table tablesConfigId(const char* biosJsonDir);
+
+Handler::Handler(const std::string& biosJsonDir,
+                 const std::string& biosTablePath) :
+    biosJsonDir(biosJsonDir),
+    biosTablePath(biosTablePath),
+    configId(tablesConfigId(biosJsonDir.c_str())),
+    journal(this->biosTablePath / attrValTableFile)
 {
     try
     {
-        fs::remove(
-            fs::path(std::string(BIOS_TABLES_DIR) + "/" + stringTableFile));
-        fs::remove(
-            fs::path(std::string(BIOS_TABLES_DIR) + "/" + attrTableFile));
-        fs::remove(
-            fs::path(std::string(BIOS_TABLES_DIR) + "/" + attrValTableFile));
+        if (loadTables())
+        {
+            loadAttrValues();
+        }
+        else
+        {
+            fs::remove(this->biosTablePath / tablesConfigFile);
+            fs::remove(this->biosTablePath / stringTableFile);
+            fs::remove(this->biosTablePath / attrTableFile);
+            fs::remove(this->biosTablePath / attrValTableFile);
+            journal.reset();
+        }
     }
     catch (const std::exception& e)
     {
+        std::cerr << "Failed to reuse the persisted BIOS tables, ERROR="
+                  << e.what() << "\n";
     }
     handlers.emplace(PLDM_SET_DATE_TIME,
                      [this](const pldm_msg* request, size_t payloadLength) {
@@ -137,6 +154,11 @@ Handler::Handler()
                      });
 }
 
+Handler::~Handler()
+{
+    watchAttrValues(nullptr);
+}
+
 Response Handler::getDateTime(const pldm_msg* request, size_t /*payloadLength*/)
 {
     uint8_t seconds = 0;
@@ -227,32 +249,38 @@ Response Handler::setDateTime(const pldm_msg* request, size_t payloadLength)
     return ccOnlyResponse(request, PLDM_SUCCESS);
 }
 
-/** @brief Construct the BIOS string table
+/** @brief Encode a GetBIOSTable response carrying a whole table
  *
- *  @param[in,out] biosStringTable - the string table
  *  @param[in] request - Request message
+ *  @param[in] table - the table
+ *  @return Response - PLDM Response message
  */
-Response getBIOSStringTable(BIOSTable& biosStringTable, const pldm_msg* request)
-
+Response encodeBIOSTableResponse(const pldm_msg* request, const Table& table)
 {
-    Response response(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES,
+    Response response(sizeof(pldm_msg_hdr) +
+                          PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES + table.size(),
                       0);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-    if (!biosStringTable.isEmpty())
+    // The encoder only copies the table data
+    auto rc = encode_get_bios_table_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, 0 /* nxtTransferHandle */,
+        PLDM_START_AND_END, const_cast<uint8_t*>(table.data()),
+        response.size(), responsePtr);
+    if (rc != PLDM_SUCCESS)
     {
-        auto rc = encode_get_bios_table_resp(
-            request->hdr.instance_id, PLDM_SUCCESS,
-            0, /* next transfer handle */
-            PLDM_START_AND_END, nullptr, response.size(),
-            responsePtr); // filling up the header here
-        if (rc != PLDM_SUCCESS)
-        {
-            return CmdHandler::ccOnlyResponse(request, rc);
-        }
-
-        biosStringTable.load(response);
-        return response;
+        return CmdHandler::ccOnlyResponse(request, rc);
     }
+
+    return response;
+}
+
+/** @brief Construct the BIOS string table
+ *
+ *  @param[out] stringTable - the string table
+ *  @return pldm_completion_codes
+ */
+int constructStringTable(Table& stringTable)
+{
     auto biosStrings = bios_parser::getStrings();
     std::sort(biosStrings.begin(), biosStrings.end());
     // remove all duplicate strings received from bios json
@@ -266,39 +294,43 @@ Response getBIOSStringTable(BIOSTable& biosStringTable, const pldm_msg* request)
                    pldm_bios_table_string_entry_encode_length(elem.length());
         });
 
-    Table stringTable;
-    stringTable.reserve(
+    stringTable.resize(
         pldm::responder::utils::getTableTotalsize(sizeWithoutPad));
-
-    stringTable.resize(sizeWithoutPad);
-    auto tablePtr = stringTable.data();
+    pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, stringTable.data(),
+                                 stringTable.size());
     for (const auto& elem : biosStrings)
     {
-        auto entry_length =
-            pldm_bios_table_string_entry_encode_length(elem.length());
-        pldm_bios_table_string_entry_encode(tablePtr, sizeWithoutPad,
-                                            elem.c_str(), elem.length());
-        tablePtr += entry_length;
-        sizeWithoutPad -= entry_length;
+        pldm_bios_table_builder_string_add(&builder, elem.c_str(),
+                                           elem.length(), nullptr);
     }
-
-    pldm::responder::utils::padAndChecksum(stringTable);
-    biosStringTable.store(stringTable);
-    response.resize(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES +
-                        stringTable.size(),
-                    0);
-    responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-    auto rc = encode_get_bios_table_resp(
-        request->hdr.instance_id, PLDM_SUCCESS, 0 /* nxtTransferHandle */,
-        PLDM_START_AND_END, stringTable.data(), response.size(), responsePtr);
+    size_t tableSize{};
+    auto rc = pldm_bios_table_builder_finish(&builder, &tableSize);
     if (rc != PLDM_SUCCESS)
     {
-        return CmdHandler::ccOnlyResponse(request, rc);
+        auto errmsg = pldm_bios_table_builder_errmsg(&builder);
+        std::cerr << "Failed to build BIOS string table, ERROR="
+                  << (errmsg ? errmsg : "") << "\n";
     }
 
-    return response;
+    return rc;
 }
 
+/** @brief Adds an attribute table entry to a builder, or sizes it
+ */
+using AttrEntryAdder = std::function<int(pldm_bios_table_builder& builder)>;
+using AttrEntryAdders = std::vector<AttrEntryAdder>;
+
+/** @struct AttrValueEntry
+ *  @brief An attribute value table entry, to encode once the table is sized
+ */
+struct AttrValueEntry
+{
+    size_t length;
+    std::function<void(uint8_t* entry, size_t length)> encode;
+};
+using AttrValueEntries = std::vector<AttrValueEntry>;
+
 namespace bios_type_enum
 {
 
@@ -316,8 +348,8 @@ using namespace bios_parser::bios_enum;
  *  @return - std::vector<uint8_t> - indices into the array of the possible
  *                                   values of string handles
  */
-std::vector<uint8_t> findStrIndices(PossibleValuesByHandle possiVals,
-                                    CurrentValues currVals,
+std::vector<uint8_t> findStrIndices(const PackedSpan<StringHandle>& possiVals,
+                                    const CurrentValues& currVals,
                                     const BIOSStringTable& biosStringTable)
 {
     std::vector<uint8_t> stringIndices;
@@ -381,11 +413,11 @@ std::vector<uint8_t> findDefaultValHandle(const PossibleValues& possiVals,
  *         Enumeration ReadOnly
  *  @param[in] biosStringTable - the string table
  *  @param[in] biosJsonDir - path where the BIOS json files are present
- *  @param[in,out] attributeTable - the attribute table
+ *  @param[in,out] adders - the adders of the attribute table entries
  *
  */
 void constructAttrTable(const BIOSStringTable& biosStringTable,
-                        Table& attributeTable)
+                        AttrEntryAdders& adders)
 {
     const auto& attributeMap = getValues();
     StringHandle strHandle;
@@ -422,28 +454,28 @@ void constructAttrTable(const BIOSStringTable& biosStringTable,
             }
         }
         auto defValsByHdl = findDefaultValHandle(possiVals, defVals);
-        auto entryLength = pldm_bios_table_attr_entry_enum_encode_length(
-            possiValsByHdl.size(), defValsByHdl.size());
-
-        auto attrTableSize = attributeTable.size();
-        attributeTable.resize(attrTableSize + entryLength, 0);
-        struct pldm_bios_table_attr_entry_enum_info info = {
-            strHandle,
-            readOnly,
-            (uint8_t)possiValsByHdl.size(),
-            possiValsByHdl.data(),
-            (uint8_t)defValsByHdl.size(),
-            defValsByHdl.data(),
-        };
-        pldm_bios_table_attr_entry_enum_encode(
-            attributeTable.data() + attrTableSize, entryLength, &info);
+        adders.emplace_back(
+            [strHandle, readOnly, possiValsByHdl = std::move(possiValsByHdl),
+             defValsByHdl = std::move(defValsByHdl)](
+                pldm_bios_table_builder& builder) {
+                struct pldm_bios_table_attr_entry_enum_info info = {
+                    strHandle,
+                    readOnly,
+                    (uint8_t)possiValsByHdl.size(),
+                    possiValsByHdl.data(),
+                    (uint8_t)defValsByHdl.size(),
+                    defValsByHdl.data(),
+                };
+                return pldm_bios_table_builder_attr_enum_add(&builder, &info,
+                                                             nullptr);
+            });
     }
 }
 
 void constructAttrValueEntry(
     const struct pldm_bios_attr_table_entry* attrTableEntry,
     const std::string& attrName, const BIOSStringTable& biosStringTable,
-    Table& attrValueTable)
+    AttrValueEntries& attrValueEntries)
 {
     CurrentValues currVals;
     try
@@ -456,23 +488,23 @@ void constructAttrValueEntry(
                   << attrName.c_str() << " ERROR=" << e.what() << "\n";
         return;
     }
-    uint8_t pv_num =
-        pldm_bios_table_attr_entry_enum_decode_pv_num(attrTableEntry);
-    PossibleValuesByHandle pvHdls(pv_num, 0);
-    pldm_bios_table_attr_entry_enum_decode_pv_hdls(attrTableEntry,
-                                                   pvHdls.data(), pv_num);
     std::sort(currVals.begin(), currVals.end());
 
-    auto currValStrIndices = findStrIndices(pvHdls, currVals, biosStringTable);
+    auto currValStrIndices = findStrIndices(
+        AttrEntryView(attrTableEntry).pvHandles(), currVals, biosStringTable);
 
     auto entryLength = pldm_bios_table_attr_value_entry_encode_enum_length(
         currValStrIndices.size());
-    auto tableSize = attrValueTable.size();
-    attrValueTable.resize(tableSize + entryLength);
-    pldm_bios_table_attr_value_entry_encode_enum(
-        attrValueTable.data() + tableSize, entryLength,
-        attrTableEntry->attr_handle, attrTableEntry->attr_type,
-        currValStrIndices.size(), currValStrIndices.data());
+    attrValueEntries.push_back(
+        {entryLength,
+         [attrHandle = attrTableEntry->attr_handle,
+          attrType = attrTableEntry->attr_type,
+          currValStrIndices = std::move(currValStrIndices)](uint8_t* entry,
+                                                            size_t length) {
+             pldm_bios_table_attr_value_entry_encode_enum(
+                 entry, length, attrHandle, attrType,
+                 currValStrIndices.size(), currValStrIndices.data());
+         }});
 }
 
 } // end namespace bios_type_enum
@@ -486,11 +518,11 @@ using namespace bios_parser::bios_string;
  *         String ReadOnly
  *  @param[in] biosStringTable - the string table
  *  @param[in] biosJsonDir - path where the BIOS json files are present
- *  @param[in,out] attributeTable - the attribute table
+ *  @param[in,out] adders - the adders of the attribute table entries
  *
  */
 void constructAttrTable(const BIOSStringTable& biosStringTable,
-                        Table& attributeTable)
+                        AttrEntryAdders& adders)
 {
     const auto& attributeMap = getValues();
     StringHandle strHandle;
@@ -507,26 +539,24 @@ void constructAttrTable(const BIOSStringTable& biosStringTable,
             continue;
         }
 
-        const auto& [readOnly, strType, minStrLen, maxStrLen, defaultStrLen,
-                     defaultStr] = value;
-        auto entryLength =
-            pldm_bios_table_attr_entry_string_encode_length(defaultStrLen);
-
-        struct pldm_bios_table_attr_entry_string_info info = {
-            strHandle, readOnly,      strType,           minStrLen,
-            maxStrLen, defaultStrLen, defaultStr.data(),
-        };
-        auto attrTableSize = attributeTable.size();
-        attributeTable.resize(attrTableSize + entryLength, 0);
-        pldm_bios_table_attr_entry_string_encode(
-            attributeTable.data() + attrTableSize, entryLength, &info);
+        adders.emplace_back(
+            [strHandle, attr = value](pldm_bios_table_builder& builder) {
+                const auto& [readOnly, strType, minStrLen, maxStrLen,
+                             defaultStrLen, defaultStr] = attr;
+                struct pldm_bios_table_attr_entry_string_info info = {
+                    strHandle, readOnly,      strType,           minStrLen,
+                    maxStrLen, defaultStrLen, defaultStr.data(),
+                };
+                return pldm_bios_table_builder_attr_string_add(
+                    &builder, &info, nullptr);
+            });
     }
 }
 
 void constructAttrValueEntry(const pldm_bios_attr_table_entry* attrTableEntry,
                              const std::string& attrName,
                              const BIOSStringTable& biosStringTable,
-                             Table& attrValueTable)
+                             AttrValueEntries& attrValueEntries)
 {
     std::ignore = biosStringTable;
     std::string currStr;
@@ -544,12 +574,15 @@ void constructAttrValueEntry(const pldm_bios_attr_table_entry* attrTableEntry,
     }
     auto entryLength =
         pldm_bios_table_attr_value_entry_encode_string_length(currStrLen);
-    auto tableSize = attrValueTable.size();
-    attrValueTable.resize(tableSize + entryLength);
-    pldm_bios_table_attr_value_entry_encode_string(
-        attrValueTable.data() + tableSize, entryLength,
-        attrTableEntry->attr_handle, attrTableEntry->attr_type, currStrLen,
-        currStr.c_str());
+    attrValueEntries.push_back(
+        {entryLength,
+         [attrHandle = attrTableEntry->attr_handle,
+          attrType = attrTableEntry->attr_type,
+          currStr = std::move(currStr)](uint8_t* entry, size_t length) {
+             pldm_bios_table_attr_value_entry_encode_string(
+                 entry, length, attrHandle, attrType, currStr.size(),
+                 currStr.c_str());
+         }});
 }
 
 } // end namespace bios_type_string
@@ -562,11 +595,11 @@ using namespace bios_parser::bios_integer;
 /** @brief Construct the attibute table for BIOS type Integer and
  *         Integer ReadOnly
  *  @param[in] biosStringTable - the string table
- *  @param[in,out] attributeTable - the attribute table
+ *  @param[in,out] adders - the adders of the attribute table entries
  *
  */
 void constructAttrTable(const BIOSStringTable& biosStringTable,
-                        Table& attributeTable)
+                        AttrEntryAdders& adders)
 {
     const auto& attributeMap = getValues();
     StringHandle strHandle;
@@ -585,23 +618,21 @@ void constructAttrTable(const BIOSStringTable& biosStringTable,
 
         const auto& [readOnly, lowerBound, upperBound, scalarIncrement,
                      defaultValue] = value;
-        auto entryLength = pldm_bios_table_attr_entry_integer_encode_length();
-
         struct pldm_bios_table_attr_entry_integer_info info = {
             strHandle,  readOnly,        lowerBound,
             upperBound, scalarIncrement, defaultValue,
         };
-        auto attrTableSize = attributeTable.size();
-        attributeTable.resize(attrTableSize + entryLength, 0);
-        pldm_bios_table_attr_entry_integer_encode(
-            attributeTable.data() + attrTableSize, entryLength, &info);
+        adders.emplace_back([info](pldm_bios_table_builder& builder) {
+            return pldm_bios_table_builder_attr_integer_add(&builder, &info,
+                                                            nullptr);
+        });
     }
 }
 
 void constructAttrValueEntry(const pldm_bios_attr_table_entry* attrTableEntry,
                              const std::string& attrName,
                              const BIOSStringTable& biosStringTable,
-                             Table& attrValueTable)
+                             AttrValueEntries& attrValueEntries)
 {
     std::ignore = biosStringTable;
     uint64_t currentValue;
@@ -616,11 +647,13 @@ void constructAttrValueEntry(const pldm_bios_attr_table_entry* attrTableEntry,
         return;
     }
     auto entryLength = pldm_bios_table_attr_value_entry_encode_integer_length();
-    auto tableSize = attrValueTable.size();
-    attrValueTable.resize(tableSize + entryLength);
-    pldm_bios_table_attr_value_entry_encode_integer(
-        attrValueTable.data() + tableSize, entryLength,
-        attrTableEntry->attr_handle, attrTableEntry->attr_type, currentValue);
+    attrValueEntries.push_back(
+        {entryLength, [attrHandle = attrTableEntry->attr_handle,
+                       attrType = attrTableEntry->attr_type,
+                       currentValue](uint8_t* entry, size_t length) {
+             pldm_bios_table_attr_value_entry_encode_integer(
+                 entry, length, attrHandle, attrType, currentValue);
+         }});
 }
 
 } // namespace bios_type_integer
@@ -628,14 +661,9 @@ void constructAttrValueEntry(const pldm_bios_attr_table_entry* attrTableEntry,
 void traverseBIOSAttrTable(const Table& biosAttrTable,
                            AttrTableEntryHandler handler)
 {
-    std::unique_ptr<pldm_bios_table_iter, decltype(&pldm_bios_table_iter_free)>
-        iter(pldm_bios_table_iter_create(biosAttrTable.data(),
-                                         biosAttrTable.size(),
-                                         PLDM_BIOS_ATTR_TABLE),
-             pldm_bios_table_iter_free);
-    while (!pldm_bios_table_iter_is_end(iter.get()))
-    {
-        auto table_entry = pldm_bios_table_iter_attr_entry_value(iter.get());
+    for (auto table_entry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
+             biosAttrTable.data(), biosAttrTable.size()))
+    {
         try
         {
             handler(table_entry);
@@ -645,12 +673,11 @@ void traverseBIOSAttrTable(const Table& biosAttrTable,
             std::cerr << "handler fails when traversing BIOSAttrTable, ERROR="
                       << e.what() << "\n";
         }
-        pldm_bios_table_iter_next(iter.get());
     }
 }
 
 using typeHandler = std::function<void(const BIOSStringTable& biosStringTable,
-                                       Table& attributeTable)>;
+                                       AttrEntryAdders& adders)>;
 std::map<BIOSJsonName, typeHandler> attrTypeHandlers{
     {bios_parser::bIOSEnumJson, bios_type_enum::constructAttrTable},
     {bios_parser::bIOSStrJson, bios_type_string::constructAttrTable},
@@ -659,76 +686,66 @@ std::map<BIOSJsonName, typeHandler> attrTypeHandlers{
 
 /** @brief Construct the BIOS attribute table
  *
- *  @param[in,out] biosAttributeTable - the attribute table
  *  @param[in] biosStringTable - the string table
  *  @param[in] biosJsonDir - path where the BIOS json files are present
- *  @param[in] request - Request message
+ *  @param[out] attributeTable - the attribute table
+ *  @return pldm_completion_codes
  */
-Response getBIOSAttributeTable(BIOSTable& biosAttributeTable,
-                               const BIOSStringTable& biosStringTable,
-                               const char* biosJsonDir, const pldm_msg* request)
+int constructAttrTable(const BIOSStringTable& biosStringTable,
+                       const char* biosJsonDir, Table& attributeTable)
 {
-    Response response(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES,
-                      0);
-    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-    uint32_t nxtTransferHandle = 0;
-    uint8_t transferFlag = PLDM_START_AND_END;
+    AttrEntryAdders adders;
+    fs::path dir(biosJsonDir);
 
-    if (biosAttributeTable.isEmpty())
-    { // no persisted table, constructing fresh table and response
-        Table attributeTable;
-        fs::path dir(biosJsonDir);
-
-        for (auto it = attrTypeHandlers.begin(); it != attrTypeHandlers.end();
-             it++)
+    for (auto it = attrTypeHandlers.begin(); it != attrTypeHandlers.end(); it++)
+    {
+        fs::path file = dir / it->first;
+        if (fs::exists(file))
         {
-            fs::path file = dir / it->first;
-            if (fs::exists(file))
-            {
-                it->second(biosStringTable, attributeTable);
-            }
+            it->second(biosStringTable, adders);
         }
+    }
 
-        if (attributeTable.empty())
-        { // no available json file is found
-            return CmdHandler::ccOnlyResponse(request,
-                                              PLDM_BIOS_TABLE_UNAVAILABLE);
-        }
-        pldm::responder::utils::padAndChecksum(attributeTable);
-        biosAttributeTable.store(attributeTable);
-        response.resize(sizeof(pldm_msg_hdr) +
-                        PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES +
-                        attributeTable.size());
-        responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-
-        auto rc = encode_get_bios_table_resp(
-            request->hdr.instance_id, PLDM_SUCCESS, nxtTransferHandle,
-            transferFlag, attributeTable.data(), response.size(), responsePtr);
-        if (rc != PLDM_SUCCESS)
-        {
-            return CmdHandler::ccOnlyResponse(request, rc);
-        }
+    if (adders.empty())
+    { // no available json file is found
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
     }
-    else
-    { // persisted table present, constructing response
-        auto rc = encode_get_bios_table_resp(
-            request->hdr.instance_id, PLDM_SUCCESS, nxtTransferHandle,
-            transferFlag, nullptr, response.size(),
-            responsePtr); // filling up the header here
-        if (rc != PLDM_SUCCESS)
+
+    // Size the table, then build it in a buffer of that size
+    pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, nullptr, 0);
+    for (const auto& add : adders)
+    {
+        add(builder);
+    }
+    size_t tableSize{};
+    auto rc = pldm_bios_table_builder_finish(&builder, &tableSize);
+    if (rc == PLDM_SUCCESS)
+    {
+        attributeTable.resize(tableSize);
+        pldm_bios_table_builder_init(&builder, attributeTable.data(),
+                                     attributeTable.size());
+        for (const auto& add : adders)
         {
-            return CmdHandler::ccOnlyResponse(request, rc);
+            add(builder);
         }
-        biosAttributeTable.load(response);
+        rc = pldm_bios_table_builder_finish(&builder, &tableSize);
+    }
+    if (rc != PLDM_SUCCESS)
+    {
+        auto errmsg = pldm_bios_table_builder_errmsg(&builder);
+        std::cerr << "Failed to build BIOS attribute table, ERROR="
+                  << (errmsg ? errmsg : "") << "\n";
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
     }
 
-    return response;
+    return PLDM_SUCCESS;
 }
 
-using AttrValTableEntryConstructHandler =
-    std::function<void(const struct pldm_bios_attr_table_entry* tableEntry,
-                       const std::string& attrName,
-                       const BIOSStringTable& biosStringTable, Table& table)>;
+using AttrValTableEntryConstructHandler = std::function<void(
+    const struct pldm_bios_attr_table_entry* tableEntry,
+    const std::string& attrName, const BIOSStringTable& biosStringTable,
+    AttrValueEntries& attrValueEntries)>;
 
 using AttrType = uint8_t;
 const std::map<AttrType, AttrValTableEntryConstructHandler>
@@ -745,15 +762,15 @@ const std::map<AttrType, AttrValTableEntryConstructHandler>
 
 void constructAttrValueTableEntry(
     const struct pldm_bios_attr_table_entry* attrEntry,
-    const BIOSStringTable& biosStringTable, Table& attributeValueTable)
+    const BIOSStringTable& biosStringTable, AttrValueEntries& attrValueEntries)
 {
     auto stringHandle =
         pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
     try
     {
-        auto attrName = biosStringTable.findString(stringHandle);
+        std::string attrName(biosStringTable.findString(stringHandle));
         AttrValTableConstructMap.at(attrEntry->attr_type)(
-            attrEntry, attrName, biosStringTable, attributeValueTable);
+            attrEntry, attrName, biosStringTable, attrValueEntries);
     }
     catch (const std::exception& e)
     {
@@ -762,77 +779,468 @@ void constructAttrValueTableEntry(
     }
 }
 
-/** @brief Construct the BIOS attribute value table
+/** @brief Construct the BIOS attribute value table, the values are read
+ *         first so the table is allocated once
  *
- *  @param[in,out] biosAttributeValueTable - the attribute value table
- *  @param[in] biosAttributeTable - the attribute table
+ *  @param[in] attributeTable - the attribute table
  *  @param[in] biosStringTable - the string table
- *  @param[in] request - Request message
+ *  @param[in] persistedValues - attribute value table persisted by a previous
+ *                               run, its entries are kept for the attributes
+ *                               whose value can't be read
+ *  @return the attribute value table, empty if no value could be read
  */
-Response getBIOSAttributeValueTable(BIOSTable& biosAttributeValueTable,
-                                    const BIOSTable& biosAttributeTable,
-                                    const BIOSStringTable& biosStringTable,
-                                    const pldm_msg* request)
+Table constructAttrValueTable(const Table& attributeTable,
+                              const BIOSStringTable& biosStringTable,
+                              const Table& persistedValues = {})
 {
-    Response response(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES,
-                      0);
-    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-    uint32_t nxtTransferHandle = 0;
-    uint8_t transferFlag = PLDM_START_AND_END;
+    using pldm::bios::utils::BIOSTableIndex;
+    std::optional<BIOSTableIndex<PLDM_BIOS_ATTR_VAL_TABLE>> persistedIndex;
+    if (!persistedValues.empty())
+    {
+        persistedIndex.emplace(persistedValues.data(), persistedValues.size());
+    }
+
+    AttrValueEntries attrValueEntries;
+    traverseBIOSAttrTable(
+        attributeTable,
+        [&](const struct pldm_bios_attr_table_entry* entry) {
+            auto count = attrValueEntries.size();
+            constructAttrValueTableEntry(entry, biosStringTable,
+                                         attrValueEntries);
+            if (attrValueEntries.size() != count || !persistedIndex)
+            {
+                return;
+            }
+            auto persisted = persistedIndex->find(
+                persistedValues.data(), persistedValues.size(),
+                pldm_bios_table_attr_entry_decode_attribute_handle(entry));
+            if (persisted != nullptr)
+            { // e.g. the D-Bus property is not served yet
+                auto bytes = reinterpret_cast<const uint8_t*>(persisted);
+                attrValueEntries.push_back(
+                    {pldm_bios_table_attr_value_entry_length(persisted),
+                     [bytes](uint8_t* entry, size_t length) {
+                         std::copy_n(bytes, length, entry);
+                     }});
+            }
+        });
+    if (attrValueEntries.empty())
+    {
+        return {};
+    }
 
-    if (!biosAttributeValueTable.isEmpty())
+    size_t sizeWithoutPad = 0;
+    for (const auto& entry : attrValueEntries)
     {
-        auto rc = encode_get_bios_table_resp(
-            request->hdr.instance_id, PLDM_SUCCESS, nxtTransferHandle,
-            transferFlag, nullptr, response.size(),
-            responsePtr); // filling up the header here
-        if (rc != PLDM_SUCCESS)
+        sizeWithoutPad += entry.length;
+    }
+    Table attributeValueTable(
+        pldm::responder::utils::getTableTotalsize(sizeWithoutPad));
+    size_t offset = 0;
+    for (const auto& entry : attrValueEntries)
+    {
+        entry.encode(attributeValueTable.data() + offset, entry.length);
+        offset += entry.length;
+    }
+    pldm_bios_table_append_pad_checksum(attributeValueTable.data(),
+                                        attributeValueTable.size(),
+                                        sizeWithoutPad);
+    return attributeValueTable;
+}
+
+/** @brief Identify the BIOS configuration the tables are built from
+ *
+ *  @param[in] biosJsonDir - path where the BIOS json files are present
+ *  @return Table - the format version of the tables and the crc32 of the
+ *                  BIOS json files, little endian
+ */
+Table tablesConfigId(const char* biosJsonDir)
+{
+    uint32_t crc = 0;
+    for (const auto& [jsonName, handler] : attrTypeHandlers)
+    {
+        // The name is hashed with its terminator, so that a file missing
+        // differs from an empty one
+        crc = crc32_update(crc, jsonName.c_str(), jsonName.size() + 1);
+        Table content;
+        BIOSTable file((fs::path(biosJsonDir) / jsonName).c_str());
+        if (!file.isEmpty())
+        {
+            file.load(content);
+            crc = crc32_update(crc, content.data(), content.size());
+        }
+    }
+
+    Table id;
+    for (auto value : {tablesFormatVersion, crc})
+    {
+        for (size_t i = 0; i < sizeof(value); i++)
         {
-            return CmdHandler::ccOnlyResponse(request, rc);
+            id.push_back(value >> (8 * i));
         }
+    }
+    return id;
+}
 
-        biosAttributeValueTable.load(response);
-        return response;
+/** @brief Check persisted string and attribute tables before they are used
+ *
+ *  @param[in] stringTable - the string table
+ *  @param[in] attrTable - the attribute table
+ *  @return true if both tables are valid
+ */
+bool validTables(const Table& stringTable, const Table& attrTable)
+{
+    return pldm_bios_table_validate(stringTable.data(), stringTable.size(),
+                                    PLDM_BIOS_STRING_TABLE, nullptr, 0,
+                                    nullptr) == PLDM_SUCCESS &&
+           pldm_bios_table_validate(attrTable.data(), attrTable.size(),
+                                    PLDM_BIOS_ATTR_TABLE, stringTable.data(),
+                                    stringTable.size(),
+                                    nullptr) == PLDM_SUCCESS;
+}
+
+bool Handler::loadTables()
+{
+    BIOSTable config((biosTablePath / tablesConfigFile).c_str());
+    BIOSTable strings((biosTablePath / stringTableFile).c_str());
+    BIOSTable attributes((biosTablePath / attrTableFile).c_str());
+    if (config.isEmpty() || strings.isEmpty() || attributes.isEmpty())
+    {
+        return false;
     }
 
-    Table attributeValueTable;
-    Table attributeTable;
-    biosAttributeTable.load(attributeTable);
-    traverseBIOSAttrTable(
-        attributeTable,
-        [&biosStringTable, &attributeValueTable](
-            const struct pldm_bios_attr_table_entry* tableEntry) {
-            constructAttrValueTableEntry(tableEntry, biosStringTable,
-                                         attributeValueTable);
-        });
-    if (attributeValueTable.empty())
+    Table persistedId;
+    config.load(persistedId);
+    if (persistedId != configId)
+    {
+        return false;
+    }
+    Table string;
+    strings.load(string);
+    Table attribute;
+    attributes.load(attribute);
+    if (!validTables(string, attribute))
+    {
+        std::cerr << "Persisted BIOS tables are corrupted, rebuilding\n";
+        return false;
+    }
+    if (setupConfig(biosJsonDir.c_str()) != 0)
     {
-        return CmdHandler::ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
+        return false;
     }
-    pldm::responder::utils::padAndChecksum(attributeValueTable);
-    biosAttributeValueTable.store(attributeValueTable);
+    watchAttrValues(
+        [this](uint16_t attrHandle) { refreshAttrValue(attrHandle); });
+
+    // Already persisted, the snapshots are not published again
+    biosStringTable = std::make_shared<const BIOSStringTable>(string);
+    stringTable = std::make_shared<const Table>(std::move(string));
+    attrTable = std::make_shared<const Table>(std::move(attribute));
+    indexAttrTable(*attrTable, *biosStringTable);
+    attrTableIndex.emplace(attrTable->data(), attrTable->size());
+    return true;
+}
 
-    response.resize(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES +
-                    attributeValueTable.size());
-    responsePtr = reinterpret_cast<pldm_msg*>(response.data());
-    auto rc = encode_get_bios_table_resp(
-        request->hdr.instance_id, PLDM_SUCCESS, nxtTransferHandle, transferFlag,
-        attributeValueTable.data(), response.size(), responsePtr);
+void Handler::loadAttrValues()
+{
+    BIOSTable values((biosTablePath / attrValTableFile).c_str());
+    if (values.isEmpty())
+    {
+        return;
+    }
+    Table table;
+    values.load(table);
+    if (pldm_bios_table_validate(table.data(), table.size(),
+                                 PLDM_BIOS_ATTR_VAL_TABLE, attrTable->data(),
+                                 attrTable->size(), nullptr) != PLDM_SUCCESS)
+    {
+        std::cerr << "Persisted BIOS attribute values are corrupted, "
+                     "dropping them\n";
+        return;
+    }
+    journal.replay(table);
+    if (fs::exists(journal.rotatedPath()))
+    { // a compaction was cut short, the table now holds the rotated records
+        writer.store(biosTablePath / attrValTableFile,
+                     std::make_shared<const Table>(table));
+        writer.store(journal.rotatedPath(), nullptr);
+    }
+    persistedValues = std::move(table);
+}
+
+void Handler::reloadConfig()
+{
+    auto id = tablesConfigId(biosJsonDir.c_str());
+    if (id == configId)
+    {
+        return;
+    }
+
+    std::cerr << "BIOS configuration changed, rebuilding the BIOS tables\n";
+    resetConfig();
+    configId = std::move(id);
+    // The old tables are served until the new ones replace them, there is
+    // no request handled in between
+    auto rc = buildStringTable();
+    if (rc == PLDM_SUCCESS)
+    {
+        rc = buildAttrTable();
+    }
     if (rc != PLDM_SUCCESS)
     {
-        return CmdHandler::ccOnlyResponse(request, rc);
+        std::cerr << "Failed to rebuild the BIOS tables, RC=" << rc << "\n";
+        // Built again on the next GetBIOSTable
+        publish(stringTable, nullptr, stringTableFile);
+        publish(attrTable, nullptr, attrTableFile);
+        publishAttrValueTable(nullptr);
+        biosStringTable.reset();
+        writer.store(biosTablePath / tablesConfigFile, nullptr);
     }
+}
 
-    return response;
+int Handler::buildStringTable()
+{
+    if (setupConfig(biosJsonDir.c_str()) != 0)
+    {
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
+    }
+    // Subscribe before the values are read, so no change is missed
+    watchAttrValues(
+        [this](uint16_t attrHandle) { refreshAttrValue(attrHandle); });
+
+    Table table;
+    auto rc = constructStringTable(table);
+    if (rc != PLDM_SUCCESS)
+    {
+        return rc;
+    }
+    biosStringTable = std::make_shared<const BIOSStringTable>(table);
+    publish(stringTable, std::make_shared<const Table>(std::move(table)),
+            stringTableFile);
+    // The other tables refer to the strings by handle
+    publish(attrTable, nullptr, attrTableFile);
+    publishAttrValueTable(nullptr);
+    writer.store(biosTablePath / tablesConfigFile, nullptr);
+
+    return PLDM_SUCCESS;
+}
+
+int Handler::buildAttrTable()
+{
+    if (!stringTable)
+    {
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
+    }
+
+    Table table;
+    auto rc = constructAttrTable(*biosStringTable, biosJsonDir.c_str(), table);
+    if (rc != PLDM_SUCCESS)
+    {
+        return rc;
+    }
+    publish(attrTable, std::make_shared<const Table>(std::move(table)),
+            attrTableFile);
+    publishAttrValueTable(nullptr);
+    indexAttrTable(*attrTable, *biosStringTable);
+    attrTableIndex.emplace(attrTable->data(), attrTable->size());
+    // Stored last, so the tables are on disk before they are claimed to be
+    // built from this configuration
+    writer.store(biosTablePath / tablesConfigFile,
+                 std::make_shared<const Table>(configId));
+
+    return PLDM_SUCCESS;
+}
+
+int Handler::buildAttrValueTable()
+{
+    if (!stringTable || !attrTable)
+    {
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
+    }
+
+    // Read the values in bulk, rather than one D-Bus Get per attribute
+    prefetchAttrValues();
+    auto table =
+        constructAttrValueTable(*attrTable, *biosStringTable, persistedValues);
+    if (table.empty())
+    {
+        return PLDM_BIOS_TABLE_UNAVAILABLE;
+    }
+    publishAttrValueTable(std::make_shared<Table>(std::move(table)));
+
+    return PLDM_SUCCESS;
+}
+
+void Handler::publish(Snapshot& table, Snapshot snapshot, const char* fileName)
+{
+    table = snapshot;
+    writer.store(biosTablePath / fileName, std::move(snapshot));
+}
+
+void Handler::publishAttrValueTable(std::shared_ptr<Table> table)
+{
+    attrValueTable = table;
+    if (table)
+    {
+        attrValueIndex.emplace(table->data(), table->size());
+    }
+    else
+    {
+        attrValueIndex.reset();
+    }
+    bool fromPersisted = table && !persistedValues.empty();
+    persistedValues.clear();
+    if (fromPersisted)
+    {
+        // The persisted table and its journal already hold the values that
+        // could not be read, the values read are persisted as they change or
+        // when the journal is compacted
+        return;
+    }
+    // The journal holds changes to a table that is not persisted anymore
+    journal.reset();
+    writer.store(biosTablePath / attrValTableFile, std::move(table));
+}
+
+int Handler::updateAttrValue(const uint8_t* entry, size_t length)
+{
+    size_t tableLen = attrValueTable->size();
+    if (attrValueTable.use_count() != 1)
+    {
+        // A snapshot is shared with a reader or the writer, which must not
+        // see it change
+        auto table = std::make_shared<Table>();
+        table->reserve(tableLen + length + 3);
+        table->assign(attrValueTable->begin(), attrValueTable->end());
+        attrValueTable = std::move(table);
+    }
+    else
+    {
+        // Pairs with the release of the last other owner, whose reads of the
+        // table happen before it is patched
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    // The size of the table may change:
+    //   sizeof(newTable) = tableSize + sizeof(newAttribute) -
+    //                      sizeof(oldAttribute) + pad(4-byte alignment, max =
+    //                      3)
+    // For simplicity, we use
+    //   sizeof(buffer) = tableSize + sizeof(newAttribute) + 3
+    auto& table = *attrValueTable;
+    table.resize(tableLen + length + 3);
+    auto rc = attrValueIndex->update(table.data(), &tableLen, table.size(),
+                                     entry, length);
+    table.resize(tableLen);
+    return rc;
+}
+
+void Handler::journalAttrValue(const uint8_t* entry, size_t length)
+{
+    // Journal the change instead of rewriting the whole table
+    try
+    {
+        if (journal.append(entry, length) >= journalCompactThreshold &&
+            journal.rotate())
+        {
+            // The rotated records are removed once a table holding them is
+            // on disk
+            writer.store(biosTablePath / attrValTableFile, attrValueTable);
+            writer.store(journal.rotatedPath(), nullptr);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to persist BIOS attribute value, ERROR="
+                  << e.what() << "\n";
+    }
+}
+
+void Handler::refreshAttrValue(uint16_t attrHandle)
+{
+    if (!attrValueTable)
+    { // built from the current values when requested
+        return;
+    }
+
+    try
+    {
+        auto attrEntry = attrTableIndex->find(attrTable->data(),
+                                              attrTable->size(), attrHandle);
+        if (attrEntry == nullptr)
+        {
+            return;
+        }
+
+        AttrValueEntries attrValueEntries;
+        constructAttrValueTableEntry(attrEntry, *biosStringTable,
+                                     attrValueEntries);
+        if (attrValueEntries.size() != 1)
+        {
+            return;
+        }
+        Table entry(attrValueEntries[0].length);
+        attrValueEntries[0].encode(entry.data(), entry.size());
+
+        auto current = attrValueIndex->find(
+            attrValueTable->data(), attrValueTable->size(), attrHandle);
+        if (current != nullptr &&
+            pldm_bios_table_attr_value_entry_length(current) == entry.size() &&
+            std::equal(entry.begin(), entry.end(),
+                       reinterpret_cast<const uint8_t*>(current)))
+        { // e.g. the change made by SetBIOSAttributeCurrentValue
+            return;
+        }
+
+        if (updateAttrValue(entry.data(), entry.size()) == PLDM_SUCCESS)
+        {
+            journalAttrValue(entry.data(), entry.size());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to refresh BIOS attribute value, HANDLE="
+                  << attrHandle << " ERROR=" << e.what() << "\n";
+    }
 }
 
 Response Handler::getBIOSTable(const pldm_msg* request, size_t payloadLength)
 {
-    fs::create_directory(BIOS_TABLES_DIR);
-    auto response = internal::buildBIOSTables(request, payloadLength,
-                                              BIOS_JSONS_DIR, BIOS_TABLES_DIR);
+    uint32_t transferHandle{};
+    uint8_t transferOpFlag{};
+    uint8_t tableType{};
 
-    return response;
+    auto rc = decode_get_bios_table_req(request, payloadLength, &transferHandle,
+                                        &transferOpFlag, &tableType);
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    Snapshot table;
+    switch (tableType)
+    {
+        case PLDM_BIOS_STRING_TABLE:
+            rc = stringTable ? PLDM_SUCCESS : buildStringTable();
+            table = stringTable;
+            break;
+        case PLDM_BIOS_ATTR_TABLE:
+            rc = attrTable ? PLDM_SUCCESS : buildAttrTable();
+            table = attrTable;
+            break;
+        case PLDM_BIOS_ATTR_VAL_TABLE:
+            rc = attrValueTable ? PLDM_SUCCESS : buildAttrValueTable();
+            table = attrValueTable;
+            break;
+        default:
+            rc = PLDM_INVALID_BIOS_TABLE_TYPE;
+            break;
+    }
+    if (rc != PLDM_SUCCESS)
+    {
+        return ccOnlyResponse(request, rc);
+    }
+
+    return encodeBIOSTableResponse(request, *table);
 }
 
 Response Handler::getBIOSAttributeCurrentValueByHandle(const pldm_msg* request,
@@ -850,44 +1258,19 @@ Response Handler::getBIOSAttributeCurrentValueByHandle(const pldm_msg* request,
         return ccOnlyResponse(request, rc);
     }
 
-    fs::path tablesPath(BIOS_TABLES_DIR);
-    auto stringTablePath = tablesPath / stringTableFile;
-    BIOSTable biosStringTable(stringTablePath.c_str());
-    auto attrTablePath = tablesPath / attrTableFile;
-    BIOSTable biosAttributeTable(attrTablePath.c_str());
-    if (biosAttributeTable.isEmpty() || biosStringTable.isEmpty())
+    if (!attrValueTable)
     {
-        return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
-    }
-
-    auto attrValueTablePath = tablesPath / attrValTableFile;
-    BIOSTable biosAttributeValueTable(attrValueTablePath.c_str());
-
-    if (biosAttributeValueTable.isEmpty())
-    {
-        Table attributeValueTable;
-        Table attributeTable;
-        biosAttributeTable.load(attributeTable);
-        traverseBIOSAttrTable(
-            attributeTable,
-            [&biosStringTable, &attributeValueTable](
-                const struct pldm_bios_attr_table_entry* tableEntry) {
-                constructAttrValueTableEntry(tableEntry, biosStringTable,
-                                             attributeValueTable);
-            });
-        if (attributeValueTable.empty())
+        rc = buildAttrValueTable();
+        if (rc != PLDM_SUCCESS)
         {
-            return ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
+            return ccOnlyResponse(request, rc);
         }
-        pldm::responder::utils::padAndChecksum(attributeValueTable);
-        biosAttributeValueTable.store(attributeValueTable);
     }
+    // Keep the snapshot alive while the response is encoded from it
+    auto table = attrValueTable;
 
-    Response table;
-    biosAttributeValueTable.load(table);
-
-    auto entry = pldm_bios_table_attr_value_find_by_handle(
-        table.data(), table.size(), attributeHandle);
+    auto entry =
+        attrValueIndex->find(table->data(), table->size(), attributeHandle);
     if (entry == nullptr)
     {
         return ccOnlyResponse(request, PLDM_INVALID_BIOS_ATTR_HANDLE);
@@ -925,140 +1308,49 @@ Response Handler::setBIOSAttributeCurrentValue(const pldm_msg* request,
         return ccOnlyResponse(request, rc);
     }
 
-    fs::path tablesPath(BIOS_TABLES_DIR);
-    auto stringTablePath = tablesPath / stringTableFile;
-    BIOSStringTable biosStringTable(stringTablePath.c_str());
-    auto attrTablePath = tablesPath / attrTableFile;
-    BIOSTable biosAttributeTable(attrTablePath.c_str());
-    auto attrValueTablePath = tablesPath / attrValTableFile;
-    BIOSTable biosAttributeValueTable(attrValueTablePath.c_str());
-    // TODO: Construct attribute value table if it's empty. (another commit)
-
-    Response srcTable;
-    biosAttributeValueTable.load(srcTable);
-
-    // Replace the old attribute with the new attribute, the size of table will
-    // change:
-    //   sizeof(newTableBuffer) = srcTableSize + sizeof(newAttribute) -
-    //                      sizeof(oldAttribute) + pad(4-byte alignment, max =
-    //                      3)
-    // For simplicity, we use
-    //   sizeof(newTableBuffer) = srcTableSize + sizeof(newAttribute) + 3
-    size_t destBufferLength = srcTable.size() + attributeField.length + 3;
-    Response destTable(destBufferLength);
-    size_t destTableLen = destTable.size();
-
-    rc = pldm_bios_table_attr_value_copy_and_update(
-        srcTable.data(), srcTable.size(), destTable.data(), &destTableLen,
-        attributeField.ptr, attributeField.length);
-    destTable.resize(destTableLen);
-
-    if (rc != PLDM_SUCCESS)
-    {
-        return ccOnlyResponse(request, rc);
-    }
-
-    rc = setAttributeValueOnDbus(&attributeField, biosAttributeTable,
-                                 biosStringTable);
-    if (rc != PLDM_SUCCESS)
+    if (!attrValueTable)
     {
-        return ccOnlyResponse(request, rc);
+        rc = buildAttrValueTable();
+        if (rc != PLDM_SUCCESS)
+        {
+            return ccOnlyResponse(request, rc);
+        }
     }
 
-    biosAttributeValueTable.store(destTable);
-
-    return ccOnlyResponse(request, PLDM_SUCCESS);
-}
-
-namespace internal
-{
-
-Response buildBIOSTables(const pldm_msg* request, size_t payloadLength,
-                         const char* biosJsonDir, const char* biosTablePath)
-{
-    Response response(sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_MIN_RESP_BYTES,
-                      0);
-
-    if (setupConfig(biosJsonDir) != 0)
+    // Kept to undo the update if the value can't be set on D-Bus
+    Table oldEntry;
+    if (attributeField.length >= sizeof(AttributeHandle))
     {
-        return CmdHandler::ccOnlyResponse(request, PLDM_BIOS_TABLE_UNAVAILABLE);
+        auto current = attrValueIndex->find(
+            attrValueTable->data(), attrValueTable->size(),
+            pldm_bios_table_attr_value_entry_decode_attribute_handle(
+                reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+                    attributeField.ptr)));
+        if (current != nullptr)
+        {
+            auto begin = reinterpret_cast<const uint8_t*>(current);
+            auto end = begin + pldm_bios_table_attr_value_entry_length(current);
+            oldEntry.assign(begin, end);
+        }
     }
 
-    uint32_t transferHandle{};
-    uint8_t transferOpFlag{};
-    uint8_t tableType{};
-
-    auto rc = decode_get_bios_table_req(request, payloadLength, &transferHandle,
-                                        &transferOpFlag, &tableType);
+    rc = updateAttrValue(attributeField.ptr, attributeField.length);
     if (rc != PLDM_SUCCESS)
     {
-        return CmdHandler::ccOnlyResponse(request, rc);
-    }
-
-    BIOSTable biosStringTable(
-        (std::string(biosTablePath) + "/" + stringTableFile).c_str());
-    BIOSTable biosAttributeTable(
-        (std::string(biosTablePath) + "/" + attrTableFile).c_str());
-    BIOSTable biosAttributeValueTable(
-        (std::string(biosTablePath) + "/" + attrValTableFile).c_str());
-    switch (tableType)
-    {
-        case PLDM_BIOS_STRING_TABLE:
-        {
-            try
-            {
-                fs::remove(fs::path(std::string(BIOS_TABLES_DIR) + "/" +
-                                    stringTableFile));
-                fs::remove(fs::path(std::string(BIOS_TABLES_DIR) + "/" +
-                                    attrTableFile));
-                fs::remove(fs::path(std::string(BIOS_TABLES_DIR) + "/" +
-                                    attrValTableFile));
-            }
-            catch (const std::exception& e)
-            {
-            }
-
-            response = getBIOSStringTable(biosStringTable, request);
-        }
-        break;
-        case PLDM_BIOS_ATTR_TABLE:
-
-            if (biosStringTable.isEmpty())
-            {
-                rc = PLDM_BIOS_TABLE_UNAVAILABLE;
-            }
-            else
-            {
-                response = getBIOSAttributeTable(
-                    biosAttributeTable, biosStringTable, biosJsonDir, request);
-            }
-            break;
-        case PLDM_BIOS_ATTR_VAL_TABLE:
-            if (biosAttributeTable.isEmpty() || biosStringTable.isEmpty())
-            {
-                rc = PLDM_BIOS_TABLE_UNAVAILABLE;
-            }
-            else
-            {
-                response = getBIOSAttributeValueTable(biosAttributeValueTable,
-                                                      biosAttributeTable,
-                                                      biosStringTable, request);
-            }
-            break;
-        default:
-            rc = PLDM_INVALID_BIOS_TABLE_TYPE;
-            break;
+        return ccOnlyResponse(request, rc);
     }
 
+    rc = setAttributeValueOnDbus(&attributeField);
     if (rc != PLDM_SUCCESS)
     {
-        return CmdHandler::ccOnlyResponse(request, rc);
+        updateAttrValue(oldEntry.data(), oldEntry.size());
+        return ccOnlyResponse(request, rc);
     }
 
-    return response;
-}
+    journalAttrValue(attributeField.ptr, attributeField.length);
 
-} // namespace internal
+    return ccOnlyResponse(request, PLDM_SUCCESS);
+}
 
 } // namespace bios
 } // namespace responder
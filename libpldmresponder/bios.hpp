@@ -11,6 +11,9 @@
 #include <ctime>
 #include <functional>
 #include <map>
+#include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "libpldm/bios.h"
@@ -35,24 +38,32 @@ using AttrTableEntryHandler =
 void traverseBIOSAttrTable(const bios::Table& BIOSAttrTable,
                            AttrTableEntryHandler handler);
 
-namespace internal
-{
-
-/** @brief Constructs all the BIOS Tables
+/** @class Handler
+ *
+ *  @brief Handler of the BIOS commands
  *
- *  @param[in] request - Request message
- *  @param[in] payload_length - Request message payload length
- *  @param[in] biosJsonDir - path to fetch the BIOS json files
- *  @param[in] biosTablePath - path where the BIOS tables will be persisted
+ *  The handler owns the BIOS tables as immutable snapshots: a table is never
+ *  modified while a snapshot of it is held outside the handler, an update
+ *  then publishes a new snapshot. Requests are
+ *  served from the snapshots in memory, and each snapshot published is
+ *  persisted to the BIOS table directory in the background. Setting an
+ *  attribute value journals the change rather than rewriting the value
+ *  table. The tables are reused across restarts as long as the BIOS
+ *  configuration is unchanged, the attribute values are read again and the
+ *  persisted ones are only kept for the attributes that can't be read.
  */
-Response buildBIOSTables(const pldm_msg* request, size_t payloadLength,
-                         const char* biosJsonDir, const char* biosTablePath);
-} // namespace internal
-
 class Handler : public CmdHandler
 {
   public:
-    Handler();
+    /** @brief Constructor
+     *
+     *  @param[in] biosJsonDir - path where the BIOS json files are present
+     *  @param[in] biosTablePath - path where the BIOS tables are persisted
+     */
+    Handler(const std::string& biosJsonDir, const std::string& biosTablePath);
+
+    /** @brief Stops watching the attribute values on D-Bus */
+    ~Handler();
 
     /** @brief Handler for GetDateTime
      *
@@ -94,6 +105,121 @@ class Handler : public CmdHandler
      */
     Response setBIOSAttributeCurrentValue(const pldm_msg* request,
                                           size_t payloadLength);
+
+    /** @brief Rebuild the string and attribute tables if the BIOS json files
+     *         changed since the tables were built
+     *
+     *  The new tables replace the old ones once built, the attribute value
+     *  table is built again on the next request for it.
+     */
+    void reloadConfig();
+
+  private:
+    using Snapshot = BIOSTableWriter::Snapshot;
+
+    /** @brief Reuse the string and attribute tables persisted by a previous
+     *         run, if they were built from the current configuration
+     *
+     *  @return true if the tables are reused
+     */
+    bool loadTables();
+
+    /** @brief Load the attribute value table persisted by a previous run
+     *         and replay its journal, for the attribute value table to be
+     *         built with
+     */
+    void loadAttrValues();
+
+    /** @brief Construct the string table from the BIOS json files, the
+     *         attribute and attribute value tables are dropped
+     *
+     *  @return pldm_completion_codes
+     */
+    int buildStringTable();
+
+    /** @brief Construct the attribute table, the attribute value table is
+     *         dropped
+     *
+     *  @return pldm_completion_codes
+     */
+    int buildAttrTable();
+
+    /** @brief Construct the attribute value table from the current values,
+     *         the attributes whose value can't be read keep their persisted
+     *         values
+     *
+     *  @return pldm_completion_codes
+     */
+    int buildAttrValueTable();
+
+    /** @brief Replace a table with a new snapshot and persist it
+     *
+     *  @param[in,out] table - the table
+     *  @param[in] snapshot - the new snapshot, nullptr to drop the table
+     *  @param[in] fileName - file where the table is persisted
+     */
+    void publish(Snapshot& table, Snapshot snapshot, const char* fileName);
+
+    /** @brief Replace the attribute value table and persist it, changes
+     *         journaled for the table being replaced are dropped
+     *
+     *  A table built from the persisted one is not persisted again, the
+     *  journal still applies to it.
+     *
+     *  @param[in] table - the new table, nullptr to drop the table
+     */
+    void publishAttrValueTable(std::shared_ptr<Table> table);
+
+    /** @brief Update an entry of the attribute value table
+     *
+     *  The table is patched in place, unless a snapshot of it is still
+     *  being read or written, then a copy replaces it.
+     *
+     *  @param[in] entry - the attribute value entry
+     *  @param[in] length - length of the entry
+     *  @return pldm_completion_codes
+     */
+    int updateAttrValue(const uint8_t* entry, size_t length);
+
+    /** @brief Journal an update of the attribute value table, the table is
+     *         persisted in the background once the journal grows long
+     *
+     *  @param[in] entry - the attribute value entry that changed
+     *  @param[in] length - length of the entry
+     */
+    void journalAttrValue(const uint8_t* entry, size_t length);
+
+    /** @brief Update the entry of an attribute in the attribute value table
+     *         from its current value
+     *
+     *  @param[in] attrHandle - attribute handle
+     */
+    void refreshAttrValue(uint16_t attrHandle);
+
+    std::string biosJsonDir;
+    fs::path biosTablePath;
+    /** @brief Format version and hash of the BIOS configuration */
+    Table configId;
+    Snapshot stringTable;
+    /** @brief Index of the string table */
+    std::shared_ptr<const BIOSStringTable> biosStringTable;
+    Snapshot attrTable;
+    /** @brief Index of the attribute table */
+    std::optional<pldm::bios::utils::BIOSTableIndex<PLDM_BIOS_ATTR_TABLE>>
+        attrTableIndex;
+    /** @brief Handed out as a snapshot, see updateAttrValue() */
+    std::shared_ptr<Table> attrValueTable;
+    /** @brief Index of the attribute value table, follows its updates */
+    std::optional<pldm::bios::utils::BIOSTableIndex<PLDM_BIOS_ATTR_VAL_TABLE>>
+        attrValueIndex;
+    /** @brief Persisted attribute value table, until the attribute value
+     *         table is built
+     */
+    Table persistedValues;
+    /** @brief Changes to the persisted attribute value table */
+    BIOSValueJournal journal;
+    /** @brief Persists the snapshots, destroyed first to flush them */
+    BIOSTableWriter writer;
 };
 
 } // namespace bios
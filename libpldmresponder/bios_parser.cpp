@@ -3,13 +3,23 @@
 #include "bios_table.hpp"
 #include "utils.hpp"
 
+#include <systemd/sd-bus.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <list>
 #include <nlohmann/json.hpp>
+#include <memory>
 #include <optional>
+#include <sdbusplus/bus.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <set>
+#include <system_error>
+#include <unordered_map>
 
 #include "libpldm/bios.h"
 #include "libpldm/bios_table.h"
@@ -20,6 +30,8 @@ namespace bios_parser
 using Json = nlohmann::json;
 namespace fs = std::filesystem;
 using namespace pldm::responder::bios;
+using pldm::bios::utils::AttrEntryView;
+using pldm::bios::utils::AttrValueEntryView;
 
 const std::vector<Json> emptyJsonList{};
 const Json emptyJson{};
@@ -43,6 +55,22 @@ const std::set<std::string> SupportedDbusPropertyTypes = {
     "bool",     "uint8_t", "int16_t",  "uint16_t", "int32_t",
     "uint32_t", "int64_t", "uint64_t", "double",   "string"};
 
+/** @struct AttrRecord
+ *
+ *  What setting an attribute needs to know about it, resolved once from the
+ *  attribute table
+ */
+struct AttrRecord
+{
+    AttrName name; //!< Attribute name, keys the value cache
+    AttrType type; //!< Attribute type
+    std::optional<DBusMapping> dBusMap;
+    /** D-Bus value of each possible value, by index, for an enumeration.
+     *  std::nullopt for a possible value with no D-Bus value */
+    std::vector<std::optional<PropertyValue>> enumValues;
+    uint8_t stringType; //!< Encoding of a string
+};
+
 using BIOSStringHandler =
     std::function<int(const Json& entry, Strings& strings)>;
 using AttrLookupHandler = std::function<int(const Json& entry, AttrLookup)>;
@@ -51,6 +79,67 @@ using typeHandler = std::function<int(const Json& entry)>;
 Strings BIOSStrings;
 AttrLookup BIOSAttrLookup;
 
+/** @brief Values of the watched D-Bus properties, by attribute */
+std::map<AttrName, PropertyValue> BIOSAttrValueCache;
+/** @brief PropertiesChanged subscriptions, empty when not watching */
+std::vector<std::unique_ptr<sdbusplus::bus::match::match>> BIOSAttrMatches;
+AttrValueChangeHandler BIOSAttrValueChanged;
+/** @brief Attributes of the attribute table, by attribute handle */
+std::unordered_map<uint16_t, AttrRecord> BIOSAttrIndex;
+/** @brief Handles of the attributes of the attribute table, by name */
+std::unordered_map<AttrName, uint16_t> BIOSAttrHandles;
+
+/** @brief Group the D-Bus backed attributes by object path and interface
+ *
+ *  @param[in] uncachedOnly - skip the attributes whose value is cached
+ *  @return the attributes backed by each property, by object path and
+ *          interface
+ */
+std::map<std::pair<std::string, std::string>,
+         std::map<std::string, std::vector<AttrName>>>
+    groupAttrsByObject(bool uncachedOnly)
+{
+    std::map<std::pair<std::string, std::string>,
+             std::map<std::string, std::vector<AttrName>>>
+        groups;
+    for (const auto& [attrName, dBusMap] : BIOSAttrLookup)
+    {
+        if (dBusMap && !(uncachedOnly && BIOSAttrValueCache.count(attrName)))
+        {
+            groups[{dBusMap->objectPath, dBusMap->interface}]
+                  [dBusMap->propertyName]
+                      .push_back(attrName);
+        }
+    }
+    return groups;
+}
+
+/** @brief Get the value of the D-Bus property backing an attribute
+ *
+ *  @param[in] attrName - attribute name
+ *  @param[in] dBusMap - D-Bus property of the attribute
+ *  @return PropertyValue - the value, from the cache when watching
+ */
+PropertyValue getAttrPropertyValue(const AttrName& attrName,
+                                   const DBusMapping& dBusMap)
+{
+    auto iter = BIOSAttrValueCache.find(attrName);
+    if (iter != BIOSAttrValueCache.end())
+    {
+        return iter->second;
+    }
+
+    auto value =
+        pldm::utils::DBusHandler().getDbusPropertyVariant<PropertyValue>(
+            dBusMap.objectPath.c_str(), dBusMap.propertyName.c_str(),
+            dBusMap.interface.c_str());
+    if (!BIOSAttrMatches.empty())
+    {
+        BIOSAttrValueCache.emplace(attrName, value);
+    }
+    return value;
+}
+
 const Strings& getStrings()
 {
     return BIOSStrings;
@@ -299,10 +388,7 @@ CurrentValues getAttrValue(const AttrName& attrName)
     }
 
     const auto& dbusValToValMap = internal::dbusValToValMaps.at(attrName);
-    propValue =
-        pldm::utils::DBusHandler().getDbusPropertyVariant<PropertyValue>(
-            dBusMap->objectPath.c_str(), dBusMap->propertyName.c_str(),
-            dBusMap->interface.c_str());
+    propValue = getAttrPropertyValue(attrName, *dBusMap);
 
     auto iter = dbusValToValMap.find(propValue);
     if (iter != dbusValToValMap.end())
@@ -313,46 +399,19 @@ CurrentValues getAttrValue(const AttrName& attrName)
     return currentValues;
 }
 
-int setAttrValue(const AttrName& attrName,
-                 const pldm_bios_attr_val_table_entry* attrValueEntry,
-                 const pldm_bios_attr_table_entry* attrEntry,
-                 const BIOSStringTable& stringTable)
+int setAttrValue(const AttrRecord& record,
+                 const pldm_bios_attr_val_table_entry* attrValueEntry)
 {
-    const auto& dBusMap = BIOSAttrLookup.at(attrName);
-    if (dBusMap == std::nullopt)
-    {
-        return PLDM_SUCCESS;
-    }
-
-    uint8_t pvNum = pldm_bios_table_attr_entry_enum_decode_pv_num(attrEntry);
-    std::vector<uint16_t> pvHdls(pvNum, 0);
-    pldm_bios_table_attr_entry_enum_decode_pv_hdls(attrEntry, pvHdls.data(),
-                                                   pvNum);
-
-    uint8_t defNum =
-        pldm_bios_table_attr_value_entry_enum_decode_number(attrValueEntry);
-
-    assert(defNum == 1);
-
-    std::vector<uint8_t> currHdls(1, 0);
-    pldm_bios_table_attr_value_entry_enum_decode_handles(
-        attrValueEntry, currHdls.data(), currHdls.size());
-
-    auto valueString = stringTable.findString(pvHdls[currHdls[0]]);
-
-    const auto& dbusValToValMap = internal::dbusValToValMaps.at(attrName);
-
-    auto it = std::find_if(dbusValToValMap.begin(), dbusValToValMap.end(),
-                           [&valueString](const auto& typePair) {
-                               return typePair.second == valueString;
-                           });
-    if (it == dbusValToValMap.end())
+    auto currHdls = AttrValueEntryView(attrValueEntry).currentIndices();
+    if (currHdls.size() != 1 || currHdls[0] >= record.enumValues.size() ||
+        !record.enumValues[currHdls[0]])
     {
         std::cerr << "Invalid Enum Value\n";
         return PLDM_ERROR;
     }
 
-    internal::updateDbusProperty(dBusMap.value(), it->first);
+    internal::updateDbusProperty(*record.dBusMap,
+                                 *record.enumValues[currHdls[0]]);
 
     return PLDM_SUCCESS;
 }
@@ -450,7 +509,6 @@ const AttrValuesMap& getValues()
 std::string getAttrValue(const AttrName& attrName)
 {
     const auto& dBusMap = BIOSAttrLookup.at(attrName);
-    std::variant<std::string> propValue;
 
     if (dBusMap == std::nullopt)
     { // return default string
@@ -458,9 +516,7 @@ std::string getAttrValue(const AttrName& attrName)
         return std::get<DefaultStr>(valueEntry);
     }
 
-    return pldm::utils::DBusHandler().getDbusProperty<std::string>(
-        dBusMap->objectPath.c_str(), dBusMap->propertyName.c_str(),
-        dBusMap->interface.c_str());
+    return std::get<std::string>(getAttrPropertyValue(attrName, *dBusMap));
 }
 
 std::string stringToUtf8(BIOSStringEncoding stringType,
@@ -483,32 +539,19 @@ std::string stringToUtf8(BIOSStringEncoding stringType,
     throw std::invalid_argument("String Type Error");
 }
 
-int setAttrValue(const AttrName& attrName,
-                 const pldm_bios_attr_val_table_entry* attrValueEntry,
-                 const pldm_bios_attr_table_entry* attrEntry,
-                 const BIOSStringTable&)
+int setAttrValue(const AttrRecord& record,
+                 const pldm_bios_attr_val_table_entry* attrValueEntry)
 {
-    const auto& dBusMap = BIOSAttrLookup.at(attrName);
-    if (dBusMap == std::nullopt)
-    {
-        return PLDM_SUCCESS;
-    }
-
-    auto stringType =
-        pldm_bios_table_attr_entry_string_decode_string_type(attrEntry);
-
-    variable_field currentString{};
-    pldm_bios_table_attr_value_entry_string_decode_string(attrValueEntry,
-                                                          &currentString);
-    std::vector<uint8_t> data(currentString.ptr,
-                              currentString.ptr + currentString.length);
+    auto currentString = AttrValueEntryView(attrValueEntry).currentString();
+    std::vector<uint8_t> data(currentString.begin(), currentString.end());
 
     std::variant<std::string> value =
-        stringToUtf8(static_cast<BIOSStringEncoding>(stringType), data);
+        stringToUtf8(static_cast<BIOSStringEncoding>(record.stringType), data);
 
+    const auto& dBusMap = *record.dBusMap;
     pldm::utils::DBusHandler().setDbusProperty(
-        dBusMap->objectPath.c_str(), dBusMap->propertyName.c_str(),
-        dBusMap->interface.c_str(), value);
+        dBusMap.objectPath.c_str(), dBusMap.propertyName.c_str(),
+        dBusMap.interface.c_str(), value);
 
     return PLDM_SUCCESS;
 }
@@ -613,7 +656,6 @@ const AttrValuesMap& getValues()
 uint64_t getAttrValue(const AttrName& attrName)
 {
     const auto& dBusMap = BIOSAttrLookup.at(attrName);
-    std::variant<std::string> propValue;
 
     if (dBusMap == std::nullopt)
     { // return default string
@@ -621,25 +663,16 @@ uint64_t getAttrValue(const AttrName& attrName)
         return std::get<AttrDefaultValue>(valueEntry);
     }
 
-    return pldm::utils::DBusHandler().getDbusProperty<uint64_t>(
-        dBusMap->objectPath.c_str(), dBusMap->propertyName.c_str(),
-        dBusMap->interface.c_str());
+    return std::get<uint64_t>(getAttrPropertyValue(attrName, *dBusMap));
 }
 
-int setAttrValue(const AttrName& attrName,
-                 const pldm_bios_attr_val_table_entry* attrValueEntry,
-                 const pldm_bios_attr_table_entry*, const BIOSStringTable&)
+int setAttrValue(const AttrRecord& record,
+                 const pldm_bios_attr_val_table_entry* attrValueEntry)
 {
-    const auto& dBusMap = BIOSAttrLookup.at(attrName);
-    if (dBusMap == std::nullopt)
-    {
-        return PLDM_SUCCESS;
-    }
-
     uint64_t currentValue =
         pldm_bios_table_attr_value_entry_integer_decode_cv(attrValueEntry);
 
-    updateDbusProperty(dBusMap.value(), currentValue);
+    updateDbusProperty(*record.dBusMap, currentValue);
 
     return PLDM_SUCCESS;
 }
@@ -751,9 +784,21 @@ int setupConfig(const char* dirPath)
     return 0;
 }
 
+void resetConfig()
+{
+    watchAttrValues(nullptr);
+    BIOSAttrIndex.clear();
+    BIOSAttrHandles.clear();
+    BIOSStrings.clear();
+    BIOSAttrLookup.clear();
+    bios_enum::internal::valueMap.clear();
+    bios_enum::internal::dbusValToValMaps.clear();
+    bios_string::internal::valueMap.clear();
+    bios_integer::valueMap.clear();
+}
+
 using setAttrValueHandler = std::function<int(
-    const AttrName&, const pldm_bios_attr_val_table_entry*,
-    const pldm_bios_attr_table_entry*, const BIOSStringTable&)>;
+    const AttrRecord&, const pldm_bios_attr_val_table_entry*)>;
 
 const std::map<AttrType, setAttrValueHandler> SetAttrValueMap{{
     {PLDM_BIOS_STRING, bios_string::setAttrValue},
@@ -765,41 +810,367 @@ const std::map<AttrType, setAttrValueHandler> SetAttrValueMap{{
 
 }};
 
-int setAttributeValueOnDbus(const variable_field* attributeData,
-                            const BIOSTable& biosAttributeTable,
-                            const BIOSStringTable& stringTable)
+void indexAttrTable(const Table& attributeTable,
+                    const BIOSStringTable& stringTable)
+{
+    using pldm::bios::utils::BIOSTableIter;
+    BIOSAttrIndex.clear();
+    BIOSAttrHandles.clear();
+    for (auto attrEntry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
+             attributeTable.data(), attributeTable.size()))
+    {
+        AttrEntryView view(attrEntry);
+        try
+        {
+            AttrRecord record{};
+            record.name = stringTable.findString(view.nameHandle());
+            record.type = view.type();
+            record.dBusMap = BIOSAttrLookup.at(record.name);
+            switch (record.type)
+            {
+                case PLDM_BIOS_ENUMERATION:
+                case PLDM_BIOS_ENUMERATION_READ_ONLY:
+                {
+                    if (!record.dBusMap)
+                    {
+                        break;
+                    }
+                    const auto& dbusValToValMap =
+                        bios_enum::internal::dbusValToValMaps.at(record.name);
+                    for (auto pvHandle : view.pvHandles())
+                    {
+                        auto valueString = stringTable.findString(pvHandle);
+                        auto it = std::find_if(
+                            dbusValToValMap.begin(), dbusValToValMap.end(),
+                            [&valueString](const auto& typePair) {
+                                return typePair.second == valueString;
+                            });
+                        record.enumValues.push_back(
+                            it == dbusValToValMap.end()
+                                ? std::nullopt
+                                : std::optional<PropertyValue>(it->first));
+                    }
+                    break;
+                }
+                case PLDM_BIOS_STRING:
+                case PLDM_BIOS_STRING_READ_ONLY:
+                    record.stringType = view.stringType();
+                    break;
+                default:
+                    break;
+            }
+            BIOSAttrHandles.emplace(record.name, view.handle());
+            BIOSAttrIndex.emplace(view.handle(), std::move(record));
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Failed to index BIOS attribute, HANDLE="
+                      << view.handle() << " ERROR=" << e.what() << "\n";
+        }
+    }
+}
+
+int setAttributeValueOnDbus(const variable_field* attributeData)
 {
-    Table attributeTable;
-    biosAttributeTable.load(attributeTable);
     auto attrValueEntry =
         reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
             attributeData->ptr);
 
-    auto attrType =
-        pldm_bios_table_attr_value_entry_decode_attribute_type(attrValueEntry);
     auto attrHandle = pldm_bios_table_attr_value_entry_decode_attribute_handle(
         attrValueEntry);
+    auto iter = BIOSAttrIndex.find(attrHandle);
+    if (iter == BIOSAttrIndex.end())
+    {
+        std::cerr << "setAttributeValueOnDbus Error: Unknown attribute, HANDLE="
+                  << attrHandle << "\n";
+        return PLDM_ERROR;
+    }
+    const auto& record = iter->second;
+    if (!record.dBusMap)
+    {
+        return PLDM_SUCCESS;
+    }
+
+    try
+    {
+        auto rc = SetAttrValueMap.at(record.type)(record, attrValueEntry);
+        // Read back rather than guess the value the property now holds
+        BIOSAttrValueCache.erase(record.name);
+        return rc;
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "setAttributeValueOnDbus Error: " << e.what() << std::endl;
+        return PLDM_ERROR;
+    }
+}
+
+/** @brief Attributes backed by each property of an interface, by object
+ *         path
+ */
+using ObjectAttrs =
+    std::map<std::string, std::map<std::string, std::vector<AttrName>>>;
+
+/** @brief Update the cached values of the attributes backed by the
+ *         properties a PropertiesChanged signal reports
+ *
+ *  @param[in] objectAttrs - attributes of the interface of the signal
+ *  @param[in] msg - the PropertiesChanged signal
+ */
+void onPropertiesChanged(const ObjectAttrs& objectAttrs,
+                         sdbusplus::message::message& msg)
+{
+    auto object = objectAttrs.find(msg.get_path());
+    if (object == objectAttrs.end())
+    {
+        return;
+    }
+    const auto& propertyAttrs = object->second;
 
-    auto attrEntry = pldm_bios_table_attr_find_by_handle(
-        attributeTable.data(), attributeTable.size(), attrHandle);
+    std::string msgInterface;
+    std::map<std::string, PropertyValue> changed;
+    std::vector<std::string> invalidated;
+    try
+    {
+        msg.read(msgInterface, changed, invalidated);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to read PropertiesChanged, ERROR=" << e.what()
+                  << "\n";
+        return;
+    }
 
-    assert(attrEntry != nullptr);
+    std::vector<AttrName> attrNames;
+    for (const auto& [property, value] : changed)
+    {
+        auto iter = propertyAttrs.find(property);
+        if (iter == propertyAttrs.end())
+        {
+            continue;
+        }
+        for (const auto& attrName : iter->second)
+        {
+            BIOSAttrValueCache[attrName] = value;
+            attrNames.push_back(attrName);
+        }
+    }
+    for (const auto& property : invalidated)
+    {
+        auto iter = propertyAttrs.find(property);
+        if (iter == propertyAttrs.end())
+        {
+            continue;
+        }
+        for (const auto& attrName : iter->second)
+        {
+            BIOSAttrValueCache.erase(attrName);
+            attrNames.push_back(attrName);
+        }
+    }
+    for (const auto& attrName : attrNames)
+    {
+        auto iter = BIOSAttrHandles.find(attrName);
+        if (iter != BIOSAttrHandles.end())
+        {
+            BIOSAttrValueChanged(iter->second);
+        }
+    }
+}
 
-    auto attrNameHandle =
-        pldm_bios_table_attr_entry_decode_string_handle(attrEntry);
+void watchAttrValues(AttrValueChangeHandler handler)
+{
+    BIOSAttrValueChanged = std::move(handler);
+    if (!BIOSAttrValueChanged)
+    {
+        BIOSAttrMatches.clear();
+        BIOSAttrValueCache.clear();
+        return;
+    }
+    if (!BIOSAttrMatches.empty())
+    {
+        return;
+    }
 
-    auto attrName = stringTable.findString(attrNameHandle);
+    // One subscription per interface, filtered by object path here, keeps
+    // the match rules on the connection few however many objects back the
+    // attributes
+    std::map<std::string, ObjectAttrs> watched;
+    for (auto& [objectInterface, propertyAttrs] : groupAttrsByObject(false))
+    {
+        const auto& [objectPath, interface] = objectInterface;
+        watched[interface][objectPath] = std::move(propertyAttrs);
+    }
 
+    using namespace sdbusplus::bus::match::rules;
+    auto& bus = pldm::utils::DBusHandler::getBus();
     try
     {
-        auto rc = SetAttrValueMap.at(attrType)(attrName, attrValueEntry,
-                                               attrEntry, stringTable);
-        return rc;
+        for (auto& [interface, objectAttrs] : watched)
+        {
+            BIOSAttrMatches.emplace_back(
+                std::make_unique<sdbusplus::bus::match::match>(
+                    bus,
+                    type::signal() + member("PropertiesChanged") +
+                        sdbusplus::bus::match::rules::interface(
+                            pldm::utils::dbusProperties) +
+                        argN(0, interface),
+                    [objectAttrs = std::move(objectAttrs)](
+                        sdbusplus::message::message& msg) {
+                        onPropertiesChanged(objectAttrs, msg);
+                    }));
+        }
     }
     catch (const std::exception& e)
     {
-        std::cerr << "setAttributeValueOnDbus Error: " << e.what() << std::endl;
-        return PLDM_ERROR;
+        // e.g. over the match rule quota of the connection, the values are
+        // read from D-Bus every time instead
+        std::cerr << "Failed to watch the BIOS attribute values, ERROR="
+                  << e.what() << "\n";
+        BIOSAttrMatches.clear();
+        BIOSAttrValueCache.clear();
+    }
+}
+
+/** @struct GetAllCall
+ *
+ *  A GetAll of the properties of an interface, in flight
+ */
+struct GetAllCall
+{
+    std::string objectPath;
+    std::string interface;
+    std::map<std::string, std::vector<AttrName>> propertyAttrs;
+    std::unique_ptr<sd_bus_slot, decltype(&sd_bus_slot_unref)> slot{
+        nullptr, sd_bus_slot_unref};
+    bool done = false;
+    std::string error; //!< empty if the properties were read
+    std::map<std::string, PropertyValue> properties;
+};
+
+int onGetAllReply(sd_bus_message* msg, void* userData, sd_bus_error* /*err*/)
+{
+    auto& call = *static_cast<GetAllCall*>(userData);
+    call.done = true;
+    auto error = sd_bus_message_get_error(msg);
+    if (error)
+    {
+        call.error = error->message ? error->message : error->name;
+        return 0;
+    }
+    try
+    {
+        sdbusplus::message::message reply(msg);
+        reply.read(call.properties);
+    }
+    catch (const std::exception& e)
+    {
+        // e.g. a property of a type PropertyValue can't hold
+        call.error = e.what();
+    }
+    return 0;
+}
+
+void prefetchAttrValues()
+{
+    if (BIOSAttrMatches.empty())
+    { // nowhere to keep the values
+        return;
+    }
+
+    // Every GetAll is sent before any reply is waited for, so the objects
+    // are read in the time the slowest of them takes. The replies are
+    // waited for on a connection of our own, processing the shared one here
+    // would dispatch the messages queued for the rest of pldmd. It is opened
+    // to the same bus as the shared one, where the services were looked up.
+    std::optional<sdbusplus::bus::bus> dedicated;
+    try
+    {
+        dedicated.emplace(sdbusplus::bus::new_bus());
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Failed to open a D-Bus connection to prefetch the "
+                     "attribute values, ERROR="
+                  << e.what() << "\n";
+        return;
+    }
+    auto& bus = *dedicated;
+    pldm::utils::DBusHandler dBusHandler;
+    std::list<GetAllCall> calls; // released before the connection
+    for (auto& [objectInterface, propertyAttrs] : groupAttrsByObject(true))
+    {
+        auto& call = calls.emplace_back();
+        std::tie(call.objectPath, call.interface) = objectInterface;
+        call.propertyAttrs = std::move(propertyAttrs);
+        try
+        {
+            auto service = dBusHandler.getService(call.objectPath.c_str(),
+                                                  call.interface.c_str());
+            auto method = bus.new_method_call(service.c_str(),
+                                              call.objectPath.c_str(),
+                                              pldm::utils::dbusProperties,
+                                              "GetAll");
+            method.append(call.interface);
+            sd_bus_slot* slot = nullptr;
+            auto rc = sd_bus_call_async(bus.get(), &slot, method.get(),
+                                        onGetAllReply, &call, 0);
+            if (rc < 0)
+            {
+                throw std::system_error(-rc, std::generic_category());
+            }
+            call.slot.reset(slot);
+        }
+        catch (const std::exception& e)
+        {
+            call.done = true;
+            call.error = e.what();
+        }
+    }
+
+    auto pending = [&calls]() {
+        return std::any_of(calls.begin(), calls.end(),
+                           [](const auto& call) { return !call.done; });
+    };
+    while (pending())
+    {
+        // A call times out with an error reply, this ends
+        auto rc = sd_bus_process(bus.get(), nullptr);
+        if (rc == 0)
+        {
+            rc = sd_bus_wait(bus.get(), UINT64_MAX);
+        }
+        if (rc < 0)
+        {
+            std::cerr << "Failed to wait for the D-Bus replies, ERROR="
+                      << std::strerror(-rc) << "\n";
+            break;
+        }
+    }
+
+    for (const auto& call : calls)
+    {
+        if (!call.done || !call.error.empty())
+        {
+            // The attributes are read one by one instead
+            std::cerr << "Failed to get the properties, OBJPATH="
+                      << call.objectPath << " INTERFACE=" << call.interface
+                      << " ERROR="
+                      << (call.done ? call.error : "no reply") << "\n";
+            continue;
+        }
+        for (const auto& [property, attrNames] : call.propertyAttrs)
+        {
+            auto iter = call.properties.find(property);
+            if (iter == call.properties.end())
+            {
+                continue;
+            }
+            for (const auto& attrName : attrNames)
+            {
+                BIOSAttrValueCache.emplace(attrName, iter->second);
+            }
+        }
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include "bios_table.hpp"
 
+#include <functional>
 #include <map>
 #include <string>
 #include <tuple>
@@ -49,9 +50,64 @@ const Strings& getStrings();
  */
 int setupConfig(const char* dirPath);
 
-int setAttributeValueOnDbus(const variable_field* attributeData,
-                            const BIOSTable& attributeTable,
-                            const BIOSStringTable& stringTable);
+/** @brief Drop what setupConfig parsed, so that the next setupConfig parses
+ *         the BIOS Configuration JSON files again
+ *
+ *  Also stops watching the attribute values, see watchAttrValues.
+ */
+void resetConfig();
+
+/** @brief Resolve what setting each attribute of the attribute table needs
+ *         (type, D-Bus property, D-Bus value of each possible value), so
+ *         that setAttributeValueOnDbus finds it by attribute handle
+ *
+ *  setupConfig has to be invoked first. To be invoked again whenever the
+ *  attribute table changes.
+ *
+ *  @param[in] attributeTable - the attribute table
+ *  @param[in] stringTable - the string table
+ */
+void indexAttrTable(const Table& attributeTable,
+                    const BIOSStringTable& stringTable);
+
+/** @brief Set the D-Bus property of an attribute to a new value
+ *
+ *  @param[in] attributeData - attribute value entry holding the new value
+ *  @return pldm_completion_codes
+ */
+int setAttributeValueOnDbus(const variable_field* attributeData);
+
+/** @brief Called with the handle of an attribute whose value changed on
+ *         D-Bus
+ */
+using AttrValueChangeHandler = std::function<void(uint16_t attrHandle)>;
+
+/** @brief Watch the D-Bus properties backing the BIOS attributes
+ *
+ *  Subscribes to PropertiesChanged for every interface in the attribute
+ *  lookup. While watched, the getAttrValue functions read the D-Bus
+ *  properties once and then serve them from a cache that the signals keep
+ *  up to date, and the handler is called for each attribute of the
+ *  attribute table whose property changed. If the subscriptions can't be
+ *  made, the properties are read from D-Bus every time as when not watched.
+ *  setupConfig has to be invoked first, the attributes are known by handle
+ *  once indexAttrTable is.
+ *
+ *  @param[in] handler - called when an attribute value changes, nullptr to
+ *                       stop watching and drop the cache
+ */
+void watchAttrValues(AttrValueChangeHandler handler);
+
+/** @brief Read the values of the watched attributes not cached yet, with
+ *         one GetAll per D-Bus object and interface rather than one Get per
+ *         attribute
+ *
+ *  The GetAll calls are all in flight at once on a connection of their own,
+ *  this returns once every one of them is answered or timed out. Does
+ *  nothing unless the attribute values are watched. The attributes that
+ *  could not be read this way are read by getAttrValue as before.
+ */
+void prefetchAttrValues();
 
 namespace bios_enum
 {
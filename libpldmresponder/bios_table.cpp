@@ -1,8 +1,22 @@
 #include "bios_table.hpp"
 
+#include "utils.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
 #include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <system_error>
 
 #include "bios_table.h"
+#include "libpldm/utils.h"
 
 namespace pldm
 {
@@ -13,6 +27,142 @@ namespace responder
 namespace bios
 {
 
+namespace
+{
+
+constexpr auto journalSuffix = ".journal";
+constexpr auto rotatedSuffix = ".old";
+constexpr size_t recordLengthSize = sizeof(uint16_t);
+constexpr size_t recordCrcSize = sizeof(uint32_t);
+
+[[noreturn]] void throwErrno(const std::string& what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/** @brief Write a buffer to a file and sync the file
+ *
+ *  @param[in] fd - file descriptor
+ *  @param[in] data - data to write
+ *  @param[in] size - size of the data
+ */
+void writeAndSync(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0)
+    {
+        auto written = write(fd, data, size);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throwErrno("write");
+        }
+        data += written;
+        size -= written;
+    }
+    if (fdatasync(fd) < 0)
+    {
+        throwErrno("fdatasync");
+    }
+}
+
+/** @brief Sync a directory, making the entries created, renamed or removed
+ *         in it durable
+ *
+ *  @param[in] dir - directory, the current one if empty
+ */
+void syncDirectory(const fs::path& dir)
+{
+    pldm::utils::CustomFD dirFd(open(dir.empty() ? "." : dir.c_str(),
+                                     O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (dirFd() < 0)
+    {
+        throwErrno("open " + dir.string());
+    }
+    if (fsync(dirFd()) < 0)
+    {
+        throwErrno("fsync " + dir.string());
+    }
+}
+
+/** @brief Replace the content of a file, the file is either left as it was
+ *         or holds all the new content, even across a power loss
+ *
+ *  @param[in] filePath - file to write
+ *  @param[in] data - new content
+ *  @param[in] size - size of the new content
+ */
+void writeFileAtomic(const fs::path& filePath, const uint8_t* data,
+                     size_t size)
+{
+    auto dir = filePath.parent_path();
+    fs::create_directories(dir);
+    auto tmpPath = filePath;
+    tmpPath += ".tmp";
+    {
+        pldm::utils::CustomFD fd(
+            open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                 0644));
+        if (fd() < 0)
+        {
+            throwErrno("open " + tmpPath.string());
+        }
+        writeAndSync(fd(), data, size);
+    }
+    fs::rename(tmpPath, filePath);
+    // Make the rename itself durable
+    syncDirectory(dir);
+}
+
+/** @brief Read a whole file
+ *
+ *  @param[in] filePath - file to read
+ *  @return Table - content of the file, empty if there is no such file
+ */
+Table readFile(const fs::path& filePath)
+{
+    std::ifstream stream(filePath, std::ios::in | std::ios::binary);
+    return Table(std::istreambuf_iterator<char>(stream),
+                 std::istreambuf_iterator<char>());
+}
+
+/** @brief Walk the valid records at the start of a journal
+ *
+ *  @param[in] journal - content of the journal
+ *  @param[in] handler - called with the entry of each valid record
+ *  @return size_t - length of the valid records
+ */
+size_t scanJournal(
+    const Table& journal,
+    const std::function<void(const uint8_t* entry, size_t length)>& handler)
+{
+    size_t offset = 0;
+    while (journal.size() - offset >= recordLengthSize + recordCrcSize)
+    {
+        auto record = journal.data() + offset;
+        size_t length = record[0] | record[1] << 8;
+        auto recordSize = recordLengthSize + length + recordCrcSize;
+        if (length == 0 || journal.size() - offset < recordSize)
+        {
+            break;
+        }
+        auto crcPtr = record + recordLengthSize + length;
+        uint32_t crc = crcPtr[0] | crcPtr[1] << 8 | crcPtr[2] << 16 |
+                       static_cast<uint32_t>(crcPtr[3]) << 24;
+        if (crc != crc32(record, recordLengthSize + length))
+        {
+            break;
+        }
+        handler(record + recordLengthSize, length);
+        offset += recordSize;
+    }
+    return offset;
+}
+
+} // namespace
+
 BIOSTable::BIOSTable(const char* filePath) : filePath(filePath)
 {
 }
@@ -46,37 +196,255 @@ void BIOSTable::load(Response& response) const
     stream.read(reinterpret_cast<char*>(response.data() + currSize), fileSize);
 }
 
+BIOSValueJournal::BIOSValueJournal(const fs::path& tablePath) :
+    journalPath(tablePath.string() + journalSuffix),
+    rotatedJournalPath(journalPath.string() + rotatedSuffix)
+{
+}
+
+void BIOSValueJournal::recover()
+{
+    auto journal = readFile(journalPath);
+    records = 0;
+    auto validLength =
+        scanJournal(journal, [this](const uint8_t*, size_t) { records++; });
+    if (validLength != journal.size())
+    {
+        // Appending after a torn record would hide the new records
+        fs::resize_file(journalPath, validLength);
+    }
+    recovered = true;
+}
+
+size_t BIOSValueJournal::append(const uint8_t* entry, size_t length)
+{
+    if (length == 0 || length > UINT16_MAX)
+    {
+        throw std::invalid_argument("Invalid attribute value entry length");
+    }
+
+    Table record(recordLengthSize + length + recordCrcSize);
+    record[0] = length & 0xff;
+    record[1] = length >> 8;
+    std::copy_n(entry, length, record.begin() + recordLengthSize);
+    auto crc = crc32(record.data(), recordLengthSize + length);
+    auto crcPtr = record.data() + recordLengthSize + length;
+    for (size_t i = 0; i < recordCrcSize; i++)
+    {
+        crcPtr[i] = crc >> (8 * i);
+    }
+
+    try
+    {
+        if (!recovered)
+        {
+            recover();
+        }
+        fs::create_directories(journalPath.parent_path());
+        auto created = !fs::exists(journalPath);
+        pldm::utils::CustomFD fd(open(journalPath.c_str(),
+                                      O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC,
+                                      0644));
+        if (fd() < 0)
+        {
+            throwErrno("open " + journalPath.string());
+        }
+        writeAndSync(fd(), record.data(), record.size());
+        if (created)
+        {
+            // The record is lost with the file if its entry is
+            syncDirectory(journalPath.parent_path());
+        }
+    }
+    catch (...)
+    {
+        // A partial record may have been written
+        recovered = false;
+        throw;
+    }
+
+    return ++records;
+}
+
+size_t BIOSValueJournal::replay(Table& table) const
+{
+    size_t applied = 0;
+    // Follows the entries as the updates move them
+    std::unique_ptr<pldm_bios_table_index,
+                    decltype(&pldm_bios_table_index_free)>
+        index(pldm_bios_table_index_create(table.data(), table.size(),
+                                           PLDM_BIOS_ATTR_VAL_TABLE),
+              pldm_bios_table_index_free);
+    if (!index)
+    {
+        return applied;
+    }
+    // The rotated records are older than the ones of the journal
+    for (const auto& path : {rotatedJournalPath, journalPath})
+    {
+        scanJournal(readFile(path), [&](const uint8_t* entry, size_t length) {
+            auto tableLength = table.size();
+            // The entry may grow the table, plus up to 3 bytes of pad
+            table.resize(tableLength + length + 3);
+            auto rc = pldm_bios_table_attr_value_update_in_place_index(
+                table.data(), &tableLength, table.size(), index.get(), entry,
+                length);
+            table.resize(tableLength);
+            if (rc == PLDM_SUCCESS)
+            {
+                applied++;
+            }
+        });
+    }
+    return applied;
+}
+
+bool BIOSValueJournal::rotate()
+{
+    if (fs::exists(rotatedJournalPath))
+    {
+        return false;
+    }
+    fs::rename(journalPath, rotatedJournalPath);
+    records = 0;
+    recovered = true;
+    syncDirectory(journalPath.parent_path());
+    return true;
+}
+
+const fs::path& BIOSValueJournal::rotatedPath() const noexcept
+{
+    return rotatedJournalPath;
+}
+
+void BIOSValueJournal::reset()
+{
+    std::error_code ec;
+    fs::remove(rotatedJournalPath, ec);
+    fs::remove(journalPath, ec);
+    records = 0;
+    // Count what is left if the journal could not be removed
+    recovered = !ec;
+}
+
+BIOSTableWriter::BIOSTableWriter() : worker(&BIOSTableWriter::run, this)
+{
+}
+
+BIOSTableWriter::~BIOSTableWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    pendingCond.notify_one();
+    worker.join();
+}
+
+void BIOSTableWriter::store(const fs::path& filePath, Snapshot table)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                     [&filePath](const auto& entry) {
+                                         return entry.first == filePath;
+                                     }),
+                      pending.end());
+        pending.emplace_back(filePath, std::move(table));
+    }
+    pendingCond.notify_one();
+}
+
+void BIOSTableWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    idleCond.wait(lock, [this] { return pending.empty() && !writing; });
+}
+
+void BIOSTableWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+        pendingCond.wait(lock, [this] { return stopping || !pending.empty(); });
+        if (pending.empty())
+        {
+            // stopping, with everything written
+            break;
+        }
+
+        auto batch = std::move(pending);
+        pending.clear();
+        writing = true;
+        lock.unlock();
+
+        for (const auto& [filePath, table] : batch)
+        {
+            try
+            {
+                if (!table)
+                {
+                    fs::remove(filePath);
+                    continue;
+                }
+                writeFileAtomic(filePath, table->data(), table->size());
+            }
+            catch (const std::exception& e)
+            {
+                std::cerr << "Failed to persist BIOS table, PATH=" << filePath
+                          << " ERROR=" << e.what() << "\n";
+            }
+        }
+
+        lock.lock();
+        writing = false;
+        if (pending.empty())
+        {
+            idleCond.notify_all();
+        }
+    }
+    idleCond.notify_all();
+}
+
+namespace
+{
+
+Table loadTable(const BIOSTable& biosTable)
+{
+    Table table;
+    biosTable.load(table);
+    return table;
+}
+
+} // namespace
+
 BIOSStringTable::BIOSStringTable(const Table& stringTable) :
-    stringTable(stringTable)
+    stringTable(stringTable),
+    index(this->stringTable.data(), this->stringTable.size())
 {
 }
 
-BIOSStringTable::BIOSStringTable(const BIOSTable& biosTable)
+BIOSStringTable::BIOSStringTable(const BIOSTable& biosTable) :
+    BIOSStringTable(loadTable(biosTable))
 {
-    biosTable.load(stringTable);
 }
 
-std::string BIOSStringTable::findString(uint16_t handle) const
+std::string_view BIOSStringTable::findString(uint16_t handle) const
 {
-    auto stringEntry = pldm_bios_table_string_find_by_handle(
-        stringTable.data(), stringTable.size(), handle);
+    auto stringEntry =
+        index.find(stringTable.data(), stringTable.size(), handle);
     if (stringEntry == nullptr)
     {
         throw std::invalid_argument("Invalid String Handle");
     }
-    auto strLength =
-        pldm_bios_table_string_entry_decode_string_length(stringEntry);
-    std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-    pldm_bios_table_string_entry_decode_string(stringEntry, buffer.data(),
-                                               buffer.size());
 
-    return std::string(buffer.data(), buffer.data() + strLength);
+    return pldm::bios::utils::StringEntryView(stringEntry).string();
 }
 
 uint16_t BIOSStringTable::findHandle(const std::string& name) const
 {
-    auto stringEntry = pldm_bios_table_string_find_by_string(
-        stringTable.data(), stringTable.size(), name.c_str());
+    auto stringEntry =
+        index.find(stringTable.data(), stringTable.size(), name.c_str());
     if (stringEntry == nullptr)
     {
         throw std::invalid_argument("Invalid String Name");
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "bios_utils.hpp"
+
 #include <stdint.h>
 
+#include <condition_variable>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "libpldm/bios.h"
@@ -71,6 +79,140 @@ class BIOSTable
     fs::path filePath;
 };
 
+/** @class BIOSValueJournal
+ *
+ *  @brief Journal of the changes made to a persisted attribute value table
+ *
+ *  Setting an attribute appends the new attribute value entry to a journal
+ *  next to the table file instead of rewriting the whole table. Each record
+ *  is checksummed, so a record torn by a power loss is detected and dropped
+ *  along with anything after it. The journal is compacted by rotating it:
+ *  its records move aside while a table holding them is persisted, then the
+ *  rotated records are removed.
+ *
+ *  Record layout (little endian):
+ *  | length (2 bytes) | attribute value entry (length bytes) | crc32 (4) |
+ *  where the crc32 covers the length and the entry.
+ */
+class BIOSValueJournal
+{
+  public:
+    /** @brief Ctor - set the table whose changes are journaled
+     *
+     *  @param[in] tablePath - file where the attribute value table is
+     *                         persisted, the journal is tablePath.journal
+     *                         and its rotated records tablePath.journal.old
+     */
+    explicit BIOSValueJournal(const fs::path& tablePath);
+
+    /** @brief Append an attribute value entry, durably
+     *
+     *  @param[in] entry - attribute value entry
+     *  @param[in] length - length of the entry
+     *  @return size_t - number of records in the journal
+     *  @throw std::system_error on I/O failure
+     */
+    size_t append(const uint8_t* entry, size_t length);
+
+    /** @brief Apply the journaled entries to a table, the rotated ones first
+     *
+     *  Entries whose attribute is not in the table are skipped.
+     *
+     *  @param[in,out] table - attribute value table
+     *  @return size_t - number of entries applied
+     */
+    size_t replay(Table& table) const;
+
+    /** @brief Move the records aside and start an empty journal
+     *
+     *  The rotated records are to be removed once a table holding them is
+     *  persisted, until then they are replayed before the journal.
+     *
+     *  @return false if the records of a previous rotation are still there,
+     *          nothing is rotated then
+     *  @throw std::system_error on I/O failure
+     */
+    bool rotate();
+
+    /** @brief Get the file holding the rotated records */
+    const fs::path& rotatedPath() const noexcept;
+
+    /** @brief Drop the journal and its rotated records, when the table is
+     *         dropped
+     */
+    void reset();
+
+  private:
+    /** @brief Truncate a torn record left at the end of the journal and
+     *         count the records
+     */
+    void recover();
+
+    fs::path journalPath;
+    fs::path rotatedJournalPath;
+    /** @brief Records in the journal, valid once recovered */
+    size_t records = 0;
+    bool recovered = false;
+};
+
+/** @class BIOSTableWriter
+ *
+ *  @brief Persists BIOS tables in the background
+ *
+ *  store() hands an immutable snapshot of a table over to a worker thread and
+ *  returns without doing any I/O. The worker writes each table to a temporary
+ *  file, syncs it and renames it over the previous one, so a table on disk is
+ *  always complete.
+ *  Snapshots stored for a file while the worker is busy replace each other,
+ *  only the last one is written. Files are written in the order they were
+ *  last stored, so a file stored after others is only on disk once they are.
+ */
+class BIOSTableWriter
+{
+  public:
+    using Snapshot = std::shared_ptr<const Table>;
+
+    BIOSTableWriter();
+
+    /** @brief Writes the pending tables, then stops the worker */
+    ~BIOSTableWriter();
+
+    BIOSTableWriter(const BIOSTableWriter&) = delete;
+    BIOSTableWriter& operator=(const BIOSTableWriter&) = delete;
+
+    /** @brief Schedule a table to be persisted
+     *
+     *  @param[in] filePath - file where the table should be persisted
+     *  @param[in] table - snapshot of the table, nullptr to remove the file
+     */
+    void store(const fs::path& filePath, Snapshot table);
+
+    /** @brief Wait until the tables scheduled so far are written */
+    void flush();
+
+  private:
+    /** @brief Worker thread, writes the pending tables until stopped */
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable pendingCond;
+    std::condition_variable idleCond;
+    /** @brief Last snapshot scheduled for each file, in the order the
+     *         files were last stored
+     */
+    std::vector<std::pair<fs::path, Snapshot>> pending;
+    bool writing = false;
+    bool stopping = false;
+    std::thread worker;
+};
+
+/** @class BIOSStringTable
+ *
+ *  @brief Provides lookups in a BIOS string table, by handle and by string
+ *
+ *  The table is indexed once when constructed, lookups by handle are O(1) and
+ *  lookups by string are a binary search.
+ */
 class BIOSStringTable
 {
   public:
@@ -89,10 +231,11 @@ class BIOSStringTable
     /** @brief Find the string name from the BIOS string table for a string
      * handle
      *  @param[in] handle - string handle
-     *  @return name of the corresponding BIOS string
+     *  @return name of the corresponding BIOS string, a view in the table
+     *          valid as long as this object
      *  @throw std::invalid_argument if the string can not be found.
      */
-    std::string findString(uint16_t handle) const;
+    std::string_view findString(uint16_t handle) const;
 
     /** @brief Find the string handle from the BIOS string table by the given
      *         name
@@ -104,6 +247,8 @@ class BIOSStringTable
 
   private:
     Table stringTable;
+    /** @brief Index of the string table, by handle and by string */
+    pldm::bios::utils::BIOSTableIndex<PLDM_BIOS_STRING_TABLE> index;
 };
 
 } // namespace bios
@@ -13,35 +13,49 @@ namespace pdr
 
 using namespace pldm::responder::pdr_utils;
 
-void getRepoByType(const Repo& inRepo, Repo& outRepo, Type pdrType)
+/** @brief Copy the PDRs of a type from a pldm_pdr to a Repo */
+static void copyRecordsByType(const pldm_pdr* inRepo, Repo& outRepo,
+                              Type pdrType)
 {
     uint8_t* pdrData = nullptr;
     uint32_t pdrSize{};
-    auto record = pldm_pdr_find_record_by_type(inRepo.getPdr(), pdrType, NULL,
-                                               &pdrData, &pdrSize);
+    auto record =
+        pldm_pdr_find_record_by_type(inRepo, pdrType, NULL, &pdrData, &pdrSize);
     while (record)
     {
         PdrEntry pdrEntry{};
         pdrEntry.data = pdrData;
         pdrEntry.size = pdrSize;
-        pdrEntry.handle.recordHandle = inRepo.getRecordHandle(record);
+        pdrEntry.handle.recordHandle =
+            pldm_pdr_get_record_handle(inRepo, record);
         outRepo.addRecord(pdrEntry);
 
         pdrData = nullptr;
         pdrSize = 0;
-        record = pldm_pdr_find_record_by_type(inRepo.getPdr(), pdrType, record,
+        record = pldm_pdr_find_record_by_type(inRepo, pdrType, record,
                                               &pdrData, &pdrSize);
     }
 }
 
-const pldm_pdr_record* getRecordByHandle(const RepoInterface& pdrRepo,
-                                         RecordHandle recordHandle,
-                                         PdrEntry& pdrEntry)
+void getRepoByType(const Repo& inRepo, Repo& outRepo, Type pdrType)
+{
+    copyRecordsByType(inRepo.getPdr(), outRepo, pdrType);
+}
+
+void getRepoByType(const RepoSnapshot& inRepo, Repo& outRepo, Type pdrType)
+{
+    copyRecordsByType(inRepo.getPdr(), outRepo, pdrType);
+}
+
+/** @brief Get the record of PDR by the record handle from a pldm_pdr */
+static const pldm_pdr_record* findRecordByHandle(const pldm_pdr* repo,
+                                                 RecordHandle recordHandle,
+                                                 PdrEntry& pdrEntry)
 {
     uint8_t* pdrData = nullptr;
     auto record =
-        pldm_pdr_find_record(pdrRepo.getPdr(), recordHandle, &pdrData,
-                             &pdrEntry.size, &pdrEntry.handle.nextRecordHandle);
+        pldm_pdr_find_record(repo, recordHandle, &pdrData, &pdrEntry.size,
+                             &pdrEntry.handle.nextRecordHandle);
     if (record)
     {
         pdrEntry.data = pdrData;
@@ -50,6 +64,20 @@ const pldm_pdr_record* getRecordByHandle(const RepoInterface& pdrRepo,
     return record;
 }
 
+const pldm_pdr_record* getRecordByHandle(const RepoInterface& pdrRepo,
+                                         RecordHandle recordHandle,
+                                         PdrEntry& pdrEntry)
+{
+    return findRecordByHandle(pdrRepo.getPdr(), recordHandle, pdrEntry);
+}
+
+const pldm_pdr_record* getRecordByHandle(const RepoSnapshot& pdrRepo,
+                                         RecordHandle recordHandle,
+                                         PdrEntry& pdrEntry)
+{
+    return findRecordByHandle(pdrRepo.getPdr(), recordHandle, pdrEntry);
+}
+
 } // namespace pdr
 } // namespace responder
 } // namespace pldm
@@ -28,6 +28,14 @@ namespace pdr
  */
 void getRepoByType(const Repo& inRepo, Repo& outRepo, Type pdrType);
 
+/** @brief Copy the PDRs of a type from a snapshot of a pdr::VersionedRepo
+ *
+ *  @param[in] inRepo - snapshot to copy the PDRs from
+ *  @param[out] outRepo - repository the PDRs are added to
+ *  @param[in] pdrType - the type of PDRs
+ */
+void getRepoByType(const RepoSnapshot& inRepo, Repo& outRepo, Type pdrType);
+
 /** @brief Get the record of PDR by the record handle
  *
  *  @param[in] pdrRepo - pdr::RepoInterface
@@ -41,6 +49,19 @@ const pldm_pdr_record* getRecordByHandle(const RepoInterface& pdrRepo,
                                          RecordHandle recordHandle,
                                          PdrEntry& pdrEntry);
 
+/** @brief Get the record of PDR by the record handle
+ *
+ *  @param[in] pdrRepo - snapshot of a pdr::VersionedRepo
+ *  @param[in] recordHandle - The recordHandle value for the PDR to be
+ * retrieved.
+ *  @param[out] pdrEntry - PDR entry structure reference
+ *
+ *  @return pldm_pdr_record - Instance of pdr::RepoInterface
+ */
+const pldm_pdr_record* getRecordByHandle(const RepoSnapshot& pdrRepo,
+                                         RecordHandle recordHandle,
+                                         PdrEntry& pdrEntry);
+
 } // namespace pdr
 } // namespace responder
 } // namespace pldm
@@ -1,5 +1,7 @@
 #include "pdr.hpp"
 
+#include <chrono>
+
 namespace pldm
 {
 
@@ -20,6 +22,12 @@ RecordHandle Repo::addRecord(const PdrEntry& pdrEntry)
                         pdrEntry.handle.recordHandle);
 }
 
+RecordHandle Repo::addRecordInPlace(PdrEntry& pdrEntry)
+{
+    return pldm_pdr_add_in_place(repo, pdrEntry.size,
+                                 pdrEntry.handle.recordHandle, &pdrEntry.data);
+}
+
 const pldm_pdr_record* Repo::getFirstRecord(PdrEntry& pdrEntry)
 {
     constexpr uint32_t firstNum = 0;
@@ -65,6 +73,106 @@ bool Repo::empty()
     return !getRecordCount();
 }
 
+const pldm_pdr_record* RepoSnapshot::getFirstRecord(PdrEntry& pdrEntry) const
+{
+    constexpr uint32_t firstNum = 0;
+    uint8_t* pdrData = nullptr;
+    auto record =
+        pldm_pdr_find_record(getPdr(), firstNum, &pdrData, &pdrEntry.size,
+                             &pdrEntry.handle.nextRecordHandle);
+    if (record)
+    {
+        pdrEntry.data = pdrData;
+    }
+
+    return record;
+}
+
+const pldm_pdr_record*
+    RepoSnapshot::getNextRecord(const pldm_pdr_record* currRecord,
+                                PdrEntry& pdrEntry) const
+{
+    uint8_t* pdrData = nullptr;
+    auto record =
+        pldm_pdr_get_next_record(getPdr(), currRecord, &pdrData, &pdrEntry.size,
+                                 &pdrEntry.handle.nextRecordHandle);
+    if (record)
+    {
+        pdrEntry.data = pdrData;
+    }
+
+    return record;
+}
+
+uint32_t RepoSnapshot::getRecordHandle(const pldm_pdr_record* record) const
+{
+    return pldm_pdr_get_record_handle(getPdr(), record);
+}
+
+uint32_t RepoSnapshot::getRecordCount() const
+{
+    return pldm_pdr_get_record_count(getPdr());
+}
+
+bool RepoSnapshot::empty() const
+{
+    return !getRecordCount();
+}
+
+VersionedRepo::VersionedRepo()
+{
+    std::shared_ptr<pldm_pdr> pdr(pldm_pdr_init(), pldm_pdr_destroy);
+    auto signature = pldm_pdr_get_signature(pdr.get());
+    current = std::make_shared<Version>(
+        Version{std::move(pdr), signature,
+                std::chrono::system_clock::to_time_t(
+                    std::chrono::system_clock::now())});
+}
+
+RepoSnapshot VersionedRepo::getSnapshot() const
+{
+    auto version = std::atomic_load(&current);
+    // The records are kept alive by the version they belong to
+    std::shared_ptr<const pldm_pdr> pdr(version, version->pdr.get());
+    return RepoSnapshot(std::move(pdr), version->signature,
+                        version->updateTime);
+}
+
+uint32_t VersionedRepo::update(std::function<void(Repo& repo)> writer)
+{
+    std::lock_guard<std::mutex> lock(writerMutex);
+
+    auto currRepo = getSnapshot();
+    std::shared_ptr<pldm_pdr> next(pldm_pdr_init(), pldm_pdr_destroy);
+    Repo nextRepo(next);
+
+    PdrEntry pdrEntry{};
+    auto record = currRepo.getFirstRecord(pdrEntry);
+    while (record)
+    {
+        PdrEntry e{};
+        e.data = pdrEntry.data;
+        e.size = pdrEntry.size;
+        e.handle.recordHandle = currRepo.getRecordHandle(record);
+        nextRepo.addRecord(e);
+        record = currRepo.getNextRecord(record, pdrEntry);
+    }
+
+    writer(nextRepo);
+
+    auto signature = pldm_pdr_get_signature(next.get());
+    auto updateTime = currRepo.getUpdateTime();
+    if (signature != currRepo.getSignature())
+    {
+        updateTime = std::chrono::system_clock::to_time_t(
+            std::chrono::system_clock::now());
+    }
+    std::shared_ptr<const Version> version = std::make_shared<Version>(
+        Version{std::move(next), signature, updateTime});
+    std::atomic_store(&current, std::move(version));
+    return ++versionNum;
+}
+
 } // namespace pdr_utils
 } // namespace responder
 } // namespace pldm
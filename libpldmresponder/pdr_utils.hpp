@@ -2,10 +2,14 @@
 
 #include <stdint.h>
 
+#include <atomic>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <xyz/openbmc_project/Common/error.hpp>
@@ -97,6 +101,16 @@ class RepoInterface
      */
     virtual RecordHandle addRecord(const PdrEntry& pdrEntry) = 0;
 
+    /** @brief Add a PDR record to a PDR repository, to be constructed in place
+     *
+     *  @param[in/out] pdrEntry - PDR records entry(size, recordHandle); on
+     *                            return, data points to the zero-initialized
+     *                            record owned by the repository
+     *
+     *  @return uint32_t - record handle assigned to PDR record
+     */
+    virtual RecordHandle addRecordInPlace(PdrEntry& pdrEntry) = 0;
+
     /** @brief Get the first PDR record from a PDR repository
      *
      *  @param[in] pdrEntry - PDR records entry(data, size, nextRecordHandle)
@@ -157,10 +171,22 @@ class Repo : public RepoInterface
     {
     }
 
+    /** @brief Constructor for a Repo over a version of a VersionedRepo
+     *
+     *  @param[in] version - version of the repository, kept alive for the
+     *                       lifetime of this object
+     */
+    explicit Repo(std::shared_ptr<pldm_pdr> version) :
+        RepoInterface(version.get()), version(std::move(version))
+    {
+    }
+
     pldm_pdr* getPdr() const override;
 
     RecordHandle addRecord(const PdrEntry& pdrEntry) override;
 
+    RecordHandle addRecordInPlace(PdrEntry& pdrEntry) override;
+
     const pldm_pdr_record* getFirstRecord(PdrEntry& pdrEntry) override;
 
     const pldm_pdr_record* getNextRecord(const pldm_pdr_record* currRecord,
@@ -171,6 +197,162 @@ class Repo : public RepoInterface
     uint32_t getRecordCount() override;
 
     bool empty() override;
+
+  private:
+    /** @brief Version of a VersionedRepo this object refers to, if any */
+    std::shared_ptr<pldm_pdr> version;
+};
+
+/**
+ *  @class RepoSnapshot
+ *
+ *  Read-only view of a version of a VersionedRepo, which keeps the version
+ *  alive for the lifetime of this object
+ */
+class RepoSnapshot
+{
+  public:
+    /** @brief Constructor
+     *
+     *  @param[in] version - version of the repository
+     *  @param[in] signature - signature of the records of the version
+     *  @param[in] updateTime - when the records last changed
+     */
+    RepoSnapshot(std::shared_ptr<const pldm_pdr> version, uint32_t signature,
+                 std::time_t updateTime) :
+        version(std::move(version)),
+        signature(signature), updateTime(updateTime)
+    {
+    }
+
+    /** @brief Get the opaque pldm_pdr structure of the version
+     *
+     *  @return const pldm_pdr* - pldm_pdr structure
+     */
+    const pldm_pdr* getPdr() const
+    {
+        return version.get();
+    }
+
+    /** @brief Get the first PDR record of the version
+     *
+     *  @param[out] pdrEntry - PDR records entry(data, size, nextRecordHandle)
+     *
+     *  @return opaque pointer acting as PDR record handle, will be NULL if
+     *          record was not found
+     */
+    const pldm_pdr_record* getFirstRecord(PdrEntry& pdrEntry) const;
+
+    /** @brief Get the next PDR record of the version
+     *
+     *  @param[in] currRecord - opaque pointer acting as a PDR record handle
+     *  @param[out] pdrEntry - PDR records entry(data, size, nextRecordHandle)
+     *
+     *  @return opaque pointer acting as PDR record handle, will be NULL if
+     *          record was not found
+     */
+    const pldm_pdr_record* getNextRecord(const pldm_pdr_record* currRecord,
+                                         PdrEntry& pdrEntry) const;
+
+    /** @brief Get record handle of a PDR record
+     *
+     *  @param[in] record - opaque pointer acting as a PDR record handle
+     *
+     *  @return uint32_t - record handle assigned to PDR record
+     */
+    uint32_t getRecordHandle(const pldm_pdr_record* record) const;
+
+    /** @brief Get number of records in the version
+     *
+     *  @return uint32_t - number of records
+     */
+    uint32_t getRecordCount() const;
+
+    /** @brief Determine if the version has no records
+     *
+     *  @return bool - true means empty and false means not empty
+     */
+    bool empty() const;
+
+    /** @brief Get the signature of the records of the version
+     *
+     *  @return uint32_t - signature, as pldm_pdr_get_signature computes it
+     */
+    uint32_t getSignature() const
+    {
+        return signature;
+    }
+
+    /** @brief Get the time the records last changed, as of the version
+     *
+     *  @return std::time_t - time of the update that changed the signature
+     */
+    std::time_t getUpdateTime() const
+    {
+        return updateTime;
+    }
+
+  private:
+    std::shared_ptr<const pldm_pdr> version;
+    uint32_t signature;
+    std::time_t updateTime;
+};
+
+/**
+ *  @class VersionedRepo
+ *
+ *  PDR repository that can be read concurrently with updates
+ *
+ *  Readers take a snapshot, an immutable version of the repository, without
+ *  blocking on writers. Writers build a new version from a copy of the current
+ *  one and publish it atomically. A version is destroyed when the last
+ *  snapshot referring to it is released. The signature of a version and the
+ *  time its records last changed are published along with it.
+ */
+class VersionedRepo
+{
+  public:
+    VersionedRepo();
+
+    /** @brief Get a snapshot of the current version of the repository
+     *
+     *  @return RepoSnapshot - view of the current version, which stays valid
+     *                         and unchanged for as long as the view is alive
+     */
+    RepoSnapshot getSnapshot() const;
+
+    /** @brief Build and publish a new version of the repository
+     *
+     *  Writers are serialized with each other, but not with readers.
+     *
+     *  @param[in] writer - function that updates the new version, which holds
+     *                      a copy of the records of the current version
+     *
+     *  @return uint32_t - the version number published
+     */
+    uint32_t update(std::function<void(Repo& repo)> writer);
+
+    /** @brief Get the version number of the current version
+     *
+     *  @return uint32_t - version number, incremented by every update
+     */
+    uint32_t getVersion() const
+    {
+        return versionNum.load();
+    }
+
+  private:
+    /** @brief A version of the repository, immutable once published */
+    struct Version
+    {
+        std::shared_ptr<pldm_pdr> pdr;
+        uint32_t signature;
+        std::time_t updateTime;
+    };
+
+    std::shared_ptr<const Version> current;
+    std::atomic<uint32_t> versionNum{0};
+    std::mutex writerMutex;
 };
 
 } // namespace pdr_utils
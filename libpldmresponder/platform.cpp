@@ -3,6 +3,8 @@
 
 #include "utils.hpp"
 
+#include <time.h>
+
 namespace pldm
 {
 namespace responder
@@ -15,14 +17,24 @@ using InternalFailure =
 
 void Handler::generateStateEffecterRepo(const Json& json, Repo& repo)
 {
+    struct StateSet
+    {
+        uint16_t id;
+        uint8_t size;
+        std::vector<uint8_t> states;
+    };
+
     static const std::vector<Json> emptyList{};
     static const Json empty{};
     auto entries = json.value("entries", emptyList);
     for (const auto& e : entries)
     {
+        // Parse the whole entry before adding the record, so that malformed
+        // JSON cannot leave a partially constructed PDR in the repository
         size_t pdrSize = 0;
         auto effecters = e.value("effecters", emptyList);
-        static const Json empty{};
+        std::vector<StateSet> stateSets{};
+        EffecterObjs paths{};
         for (const auto& effecter : effecters)
         {
             auto set = effecter.value("set", empty);
@@ -37,15 +49,27 @@ void Handler::generateStateEffecterRepo(const Json& json, Repo& repo)
             }
             pdrSize += sizeof(state_effecter_possible_states) -
                        sizeof(bitfield8_t) + (sizeof(bitfield8_t) * statesSize);
+
+            static const std::vector<uint8_t> emptyStates{};
+            stateSets.push_back({set.value("id", static_cast<uint16_t>(0)),
+                                 static_cast<uint8_t>(statesSize),
+                                 set.value("states", emptyStates)});
+            auto dbus = effecter.value("dbus", empty);
+            paths.emplace_back(std::move(dbus));
         }
         pdrSize += sizeof(pldm_state_effecter_pdr) - sizeof(uint8_t);
+        uint16_t entityType = e.value("type", 0);
+        uint16_t entityInstance = e.value("instance", 0);
+        uint16_t containerId = e.value("container", 0);
 
-        std::vector<uint8_t> entry{};
-        entry.resize(pdrSize);
+        // The PDR is built directly in the storage of the repository, which
+        // also populates the record handle in the PDR header
+        PdrEntry pdrEntry{};
+        pdrEntry.size = pdrSize;
+        repo.addRecordInPlace(pdrEntry);
 
         pldm_state_effecter_pdr* pdr =
-            reinterpret_cast<pldm_state_effecter_pdr*>(entry.data());
-        pdr->hdr.record_handle = 0;
+            reinterpret_cast<pldm_state_effecter_pdr*>(pdrEntry.data);
         pdr->hdr.version = 1;
         pdr->hdr.type = PLDM_STATE_EFFECTER_PDR;
         pdr->hdr.record_change_num = 0;
@@ -53,30 +77,26 @@ void Handler::generateStateEffecterRepo(const Json& json, Repo& repo)
 
         pdr->terminus_handle = 0;
         pdr->effecter_id = this->getNextEffecterId();
-        pdr->entity_type = e.value("type", 0);
-        pdr->entity_instance = e.value("instance", 0);
-        pdr->container_id = e.value("container", 0);
+        pdr->entity_type = entityType;
+        pdr->entity_instance = entityInstance;
+        pdr->container_id = containerId;
         pdr->effecter_semantic_id = 0;
         pdr->effecter_init = PLDM_NO_INIT;
         pdr->has_description_pdr = false;
         pdr->composite_effecter_count = effecters.size();
 
-        EffecterObjs paths{};
         uint8_t* start =
-            entry.data() + sizeof(pldm_state_effecter_pdr) - sizeof(uint8_t);
-        for (const auto& effecter : effecters)
+            pdrEntry.data + sizeof(pldm_state_effecter_pdr) - sizeof(uint8_t);
+        for (const auto& set : stateSets)
         {
-            auto set = effecter.value("set", empty);
             state_effecter_possible_states* possibleStates =
                 reinterpret_cast<state_effecter_possible_states*>(start);
-            possibleStates->state_set_id = set.value("id", 0);
-            possibleStates->possible_states_size = set.value("size", 0);
+            possibleStates->state_set_id = set.id;
+            possibleStates->possible_states_size = set.size;
 
             start += sizeof(possibleStates->state_set_id) +
                      sizeof(possibleStates->possible_states_size);
-            static const std::vector<uint8_t> emptyStates{};
-            auto states = set.value("states", emptyStates);
-            for (const auto& state : states)
+            for (const auto& state : set.states)
             {
                 auto index = state / 8;
                 auto bit = state - (index * 8);
@@ -84,15 +104,8 @@ void Handler::generateStateEffecterRepo(const Json& json, Repo& repo)
                 bf->byte |= 1 << bit;
             }
             start += possibleStates->possible_states_size;
-
-            auto dbus = effecter.value("dbus", empty);
-            paths.emplace_back(std::move(dbus));
         }
         addEffecterObjs(pdr->effecter_id, std::move(paths));
-        PdrEntry pdrEntry{};
-        pdrEntry.data = entry.data();
-        pdrEntry.size = pdrSize;
-        repo.addRecord(pdrEntry);
     }
 }
 
@@ -171,8 +184,10 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
     uint8_t* recordData = nullptr;
     try
     {
+        // Keeps the record data alive until the response is encoded
+        auto snapshot = pdrRepo.getSnapshot();
         pdr_utils::PdrEntry e;
-        auto record = pdr::getRecordByHandle(pdrRepo, recordHandle, e);
+        auto record = pdr::getRecordByHandle(snapshot, recordHandle, e);
         if (record == NULL)
         {
             return CmdHandler::ccOnlyResponse(
@@ -209,6 +224,76 @@ Response Handler::getPDR(const pldm_msg* request, size_t payloadLength)
     return response;
 }
 
+Handler::Timestamp104 Handler::toTimestamp104(std::time_t time)
+{
+    Timestamp104 timestamp{};
+    struct tm tm
+    {
+    };
+    gmtime_r(&time, &tm);
+
+    // UTC offset (sint16) and microseconds (uint24) are left as 0
+    timestamp[5] = tm.tm_sec;
+    timestamp[6] = tm.tm_min;
+    timestamp[7] = tm.tm_hour;
+    timestamp[8] = tm.tm_mday;
+    timestamp[9] = tm.tm_mon + 1;
+    uint16_t year = htole16(tm.tm_year + 1900);
+    memcpy(&timestamp[10], &year, sizeof(year));
+    // Time resolution of a second, UTC offset unspecified
+    timestamp[12] = 0x60;
+    return timestamp;
+}
+
+Response Handler::getPDRRepositoryInfo(const pldm_msg* request,
+                                       size_t payloadLength)
+{
+    if (payloadLength != 0)
+    {
+        return CmdHandler::ccOnlyResponse(request, PLDM_ERROR_INVALID_LENGTH);
+    }
+
+    auto snapshot = pdrRepo.getSnapshot();
+    auto updateTime = toTimestamp104(snapshot.getUpdateTime());
+
+    Response response(
+        sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REPOSITORY_INFO_RESP_BYTES, 0);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    static const Timestamp104 oemUpdateTime{};
+    auto pdr = snapshot.getPdr();
+    auto rc = encode_get_pdr_repository_info_resp(
+        request->hdr.instance_id, PLDM_SUCCESS, PLDM_PDR_REPOSITORY_AVAILABLE,
+        updateTime.data(), oemUpdateTime.data(),
+        pldm_pdr_get_record_count(pdr), pldm_pdr_get_repo_size(pdr),
+        pldm_pdr_get_largest_record_size(pdr), 0, responsePtr);
+    if (rc != PLDM_SUCCESS)
+    {
+        return CmdHandler::ccOnlyResponse(request, rc);
+    }
+    return response;
+}
+
+Response Handler::getPDRRepositorySignature(const pldm_msg* request,
+                                            size_t payloadLength)
+{
+    if (payloadLength != 0)
+    {
+        return CmdHandler::ccOnlyResponse(request, PLDM_ERROR_INVALID_LENGTH);
+    }
+
+    Response response(
+        sizeof(pldm_msg_hdr) + PLDM_GET_PDR_REPOSITORY_SIGNATURE_RESP_BYTES, 0);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    auto rc = encode_get_pdr_repository_signature_resp(
+        request->hdr.instance_id, PLDM_SUCCESS,
+        pdrRepo.getSnapshot().getSignature(), responsePtr);
+    if (rc != PLDM_SUCCESS)
+    {
+        return CmdHandler::ccOnlyResponse(request, rc);
+    }
+    return response;
+}
+
 Response Handler::setStateEffecterStates(const pldm_msg* request,
                                          size_t payloadLength)
 {
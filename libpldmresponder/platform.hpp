@@ -9,6 +9,8 @@
 
 #include <stdint.h>
 
+#include <array>
+#include <ctime>
 #include <map>
 
 #include "libpldm/platform.h"
@@ -27,9 +29,9 @@ using EffecterObjs = std::vector<DbusPath>;
 class Handler : public CmdHandler
 {
   public:
-    Handler(const std::string& dir, pldm_pdr* repo) : pdrRepo(repo)
+    explicit Handler(const std::string& dir)
     {
-        generate(dir, pdrRepo);
+        pdrRepo.update([this, &dir](Repo& repo) { generate(dir, repo); });
 
         handlers.emplace(PLDM_GET_PDR,
                          [this](const pldm_msg* request, size_t payloadLength) {
@@ -40,6 +42,16 @@ class Handler : public CmdHandler
                              return this->setStateEffecterStates(request,
                                                                  payloadLength);
                          });
+        handlers.emplace(PLDM_GET_PDR_REPOSITORY_INFO,
+                         [this](const pldm_msg* request, size_t payloadLength) {
+                             return this->getPDRRepositoryInfo(request,
+                                                               payloadLength);
+                         });
+        handlers.emplace(PLDM_GET_PDR_REPOSITORY_SIGNATURE,
+                         [this](const pldm_msg* request, size_t payloadLength) {
+                             return this->getPDRRepositorySignature(
+                                 request, payloadLength);
+                         });
     }
 
     const EffecterObjs& getEffecterObjs(uint16_t effecterId) const
@@ -52,6 +64,16 @@ class Handler : public CmdHandler
         effecterObjs.emplace(effecterId, std::move(paths));
     }
 
+    /** @brief Get the PDR repository of this handler
+     *
+     *  @return VersionedRepo& - repository, read through snapshots and
+     *                           changed through updates
+     */
+    pdr_utils::VersionedRepo& getRepo()
+    {
+        return pdrRepo;
+    }
+
     uint16_t getNextEffecterId()
     {
         return ++nextEffecterId;
@@ -79,6 +101,24 @@ class Handler : public CmdHandler
      */
     Response getPDR(const pldm_msg* request, size_t payloadLength);
 
+    /** @brief Handler for GetPDRRepositoryInfo
+     *
+     *  @param[in] request - Request message payload
+     *  @param[in] payloadLength - Request payload length
+     *  @return Response - PLDM Response message
+     */
+    Response getPDRRepositoryInfo(const pldm_msg* request,
+                                  size_t payloadLength);
+
+    /** @brief Handler for GetPDRRepositorySignature
+     *
+     *  @param[in] request - Request message payload
+     *  @param[in] payloadLength - Request payload length
+     *  @return Response - PLDM Response message
+     */
+    Response getPDRRepositorySignature(const pldm_msg* request,
+                                       size_t payloadLength);
+
     /** @brief Handler for setStateEffecterStates
      *
      *  @param[in] request - Request message
@@ -124,15 +164,17 @@ class Handler : public CmdHandler
         state_effecter_possible_states* states = nullptr;
         pldm_state_effecter_pdr* pdr = nullptr;
         uint8_t compEffecterCnt = stateField.size();
+        // Keeps the records pdr and states point into alive
+        auto snapshot = pdrRepo.getSnapshot();
         PdrEntry pdrEntry{};
-        auto pdrRecord = pdrRepo.getFirstRecord(pdrEntry);
+        auto pdrRecord = snapshot.getFirstRecord(pdrEntry);
         while (pdrRecord)
         {
             pdr = reinterpret_cast<pldm_state_effecter_pdr*>(pdrEntry.data);
             if (pdr->effecter_id != effecterId)
             {
                 pdr = nullptr;
-                pdrRecord = pdrRepo.getNextRecord(pdrRecord, pdrEntry);
+                pdrRecord = snapshot.getNextRecord(pdrRecord, pdrEntry);
                 continue;
             }
 
@@ -297,7 +339,17 @@ class Handler : public CmdHandler
     }
 
   private:
-    pdr_utils::Repo pdrRepo;
+    using Timestamp104 = std::array<uint8_t, PLDM_TIMESTAMP104_SIZE>;
+
+    /** @brief Convert a time to a PLDM timestamp104
+     *
+     *  @param[in] time - time to convert
+     *
+     *  @return Timestamp104 - the UTC time, with a resolution of a second
+     */
+    static Timestamp104 toTimestamp104(std::time_t time);
+
+    pdr_utils::VersionedRepo pdrRepo;
     uint16_t nextEffecterId{};
     std::map<uint16_t, EffecterObjs> effecterObjs{};
 };
@@ -10,11 +10,13 @@
 #include <getopt.h>
 #include <poll.h>
 #include <stdlib.h>
+#include <sys/inotify.h>
 #include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <array>
 #include <cstdio>
 #include <cstring>
 #include <iomanip>
@@ -146,14 +148,14 @@ int main(int argc, char** argv)
             break;
     }
 
-    std::unique_ptr<pldm_pdr, decltype(&pldm_pdr_destroy)> pdrRepo(
-        pldm_pdr_init(), pldm_pdr_destroy);
-
     Invoker invoker{};
     invoker.registerHandler(PLDM_BASE, std::make_unique<base::Handler>());
-    invoker.registerHandler(PLDM_BIOS, std::make_unique<bios::Handler>());
-    invoker.registerHandler(PLDM_PLATFORM, std::make_unique<platform::Handler>(
-                                               PDR_JSONS_DIR, pdrRepo.get()));
+    auto biosHandler = std::make_unique<responder::bios::Handler>(
+        BIOS_JSONS_DIR, BIOS_TABLES_DIR);
+    auto biosConfig = biosHandler.get();
+    invoker.registerHandler(PLDM_BIOS, std::move(biosHandler));
+    invoker.registerHandler(PLDM_PLATFORM,
+                            std::make_unique<platform::Handler>(PDR_JSONS_DIR));
     invoker.registerHandler(PLDM_FRU,
                             std::make_unique<fru::Handler>(FRU_JSONS_DIR));
 
@@ -291,6 +293,32 @@ int main(int argc, char** argv)
     bus.attach_event(event.get(), SD_EVENT_PRIORITY_NORMAL);
     bus.request_name("xyz.openbmc_project.PLDM");
     IO io(event, socketFd(), EPOLLIN, std::move(callback));
+
+    // Rebuild the BIOS tables when the BIOS json files are changed
+    pldm::utils::CustomFD biosJsonsFd(inotify_init1(IN_NONBLOCK | IN_CLOEXEC));
+    std::unique_ptr<IO> biosJsonsIO;
+    if (biosJsonsFd() < 0 ||
+        inotify_add_watch(biosJsonsFd(), BIOS_JSONS_DIR,
+                          IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM |
+                              IN_CREATE | IN_DELETE) < 0)
+    {
+        std::cerr << "Failed to watch the BIOS json files, DIR="
+                  << BIOS_JSONS_DIR << " ERROR=" << strerror(errno) << "\n";
+    }
+    else
+    {
+        biosJsonsIO = std::make_unique<IO>(
+            event, biosJsonsFd(), EPOLLIN,
+            [biosConfig](IO& /*io*/, int fd, uint32_t /*revents*/) {
+                // Only whether something changed matters, not what
+                std::array<char, 4096> events;
+                while (read(fd, events.data(), events.size()) > 0)
+                {
+                }
+                biosConfig->reloadConfig();
+            });
+    }
+
     event.loop();
 
     result = shutdown(sockfd, SHUT_RDWR);
@@ -3,8 +3,12 @@
 #include <stdlib.h>
 
 #include <algorithm>
+#include <fstream>
+#include <string>
 #include <vector>
 
+#include "libpldm/bios_table.h"
+
 #include <gtest/gtest.h>
 
 using namespace pldm::responder::bios;
@@ -59,3 +63,251 @@ TEST_F(TestBIOSTable, testLoadOntoExisting)
     ASSERT_EQ(out[0], 99);
     ASSERT_EQ(out[1], 99);
 }
+
+TEST_F(TestBIOSTable, testWriter)
+{
+    auto table = std::make_shared<const Table>(
+        Table{10, 34, 56, 100, 44, 55, 69, 21, 48, 2, 7, 82});
+    fs::path file(dir / "tables" / "t1");
+    BIOSTable t(file.string().c_str());
+    Table out{};
+
+    {
+        BIOSTableWriter writer;
+        writer.store(file, std::make_shared<const Table>(Table{1, 2, 3}));
+        writer.store(file, table);
+        writer.flush();
+        t.load(out);
+        EXPECT_EQ(out, *table);
+        EXPECT_FALSE(fs::exists(file.string() + ".tmp"));
+
+        writer.store(file, nullptr);
+        writer.flush();
+        EXPECT_TRUE(t.isEmpty());
+
+        // Pending tables are written when the writer is destroyed
+        writer.store(file, table);
+    }
+    out.clear();
+    t.load(out);
+    EXPECT_EQ(out, *table);
+}
+
+TEST_F(TestBIOSTable, testJournal)
+{
+    auto encodeEntry = [](uint16_t handle, uint64_t value) {
+        Table entry(pldm_bios_table_attr_value_entry_encode_integer_length());
+        pldm_bios_table_attr_value_entry_encode_integer(
+            entry.data(), entry.size(), handle, PLDM_BIOS_INTEGER, value);
+        return entry;
+    };
+    auto encodeTable = [&](const std::vector<uint64_t>& values) {
+        Table table;
+        for (size_t handle = 0; handle < values.size(); handle++)
+        {
+            auto entry = encodeEntry(handle, values[handle]);
+            table.insert(table.end(), entry.begin(), entry.end());
+        }
+        auto size = table.size();
+        table.resize(size + pldm_bios_table_pad_checksum_size(size));
+        pldm_bios_table_append_pad_checksum(table.data(), table.size(), size);
+        return table;
+    };
+
+    fs::path file(dir / "attributeValueTable");
+    fs::path journalFile(dir / "attributeValueTable.journal");
+    BIOSValueJournal journal(file);
+    auto base = encodeTable({1, 2, 3});
+
+    auto entry = encodeEntry(0, 42);
+    EXPECT_EQ(journal.append(entry.data(), entry.size()), 1);
+    entry = encodeEntry(2, 7);
+    EXPECT_EQ(journal.append(entry.data(), entry.size()), 2);
+    // Not in the table, skipped on replay
+    entry = encodeEntry(5, 9);
+    EXPECT_EQ(journal.append(entry.data(), entry.size()), 3);
+
+    auto table = base;
+    EXPECT_EQ(BIOSValueJournal(file).replay(table), 2);
+    EXPECT_EQ(table, encodeTable({42, 2, 7}));
+
+    // A torn record is dropped, and truncated before the next append
+    auto journalSize = fs::file_size(journalFile);
+    {
+        std::ofstream stream(journalFile, std::ios::app | std::ios::binary);
+        stream.write("\x0c\x00\x01\x00\x03", 5);
+    }
+    table = base;
+    EXPECT_EQ(BIOSValueJournal(file).replay(table), 2);
+    BIOSValueJournal reopened(file);
+    entry = encodeEntry(1, 5);
+    EXPECT_EQ(reopened.append(entry.data(), entry.size()), 4);
+    EXPECT_EQ(fs::file_size(journalFile), journalSize + 6 + entry.size());
+    table = base;
+    EXPECT_EQ(reopened.replay(table), 3);
+    EXPECT_EQ(table, encodeTable({42, 5, 7}));
+
+    // The rotated records are replayed before the new ones
+    EXPECT_TRUE(reopened.rotate());
+    EXPECT_FALSE(fs::exists(journalFile));
+    entry = encodeEntry(0, 8);
+    EXPECT_EQ(reopened.append(entry.data(), entry.size()), 1);
+    EXPECT_FALSE(reopened.rotate());
+    table = base;
+    EXPECT_EQ(reopened.replay(table), 4);
+    EXPECT_EQ(table, encodeTable({8, 5, 7}));
+
+    reopened.reset();
+    EXPECT_FALSE(fs::exists(journalFile));
+    EXPECT_FALSE(fs::exists(reopened.rotatedPath()));
+    table = base;
+    EXPECT_EQ(reopened.replay(table), 0);
+}
+
+TEST(BIOSStringTable, testFind)
+{
+    std::vector<std::string> strings{"Disabled", "Enabled", "HMCManaged",
+                                     "Hello"};
+    Table table;
+    for (const auto& str : strings)
+    {
+        auto offset = table.size();
+        table.resize(offset + pldm_bios_table_string_entry_encode_length(
+                                  str.length()));
+        pldm_bios_table_string_entry_encode(table.data() + offset,
+                                            table.size() - offset, str.c_str(),
+                                            str.length());
+    }
+    table.resize(table.size() +
+                 pldm_bios_table_pad_checksum_size(table.size()));
+    pldm_bios_table_append_pad_checksum(
+        table.data(), table.size(),
+        table.size() - pldm_bios_table_pad_checksum_size(table.size()));
+
+    BIOSStringTable stringTable(table);
+    // A copy of the table keeps working on its own copy of the data
+    BIOSStringTable copy(stringTable);
+    for (const auto* t : {&stringTable, &copy})
+    {
+        for (const auto& str : strings)
+        {
+            EXPECT_EQ(t->findString(t->findHandle(str)), str);
+        }
+        EXPECT_THROW(t->findHandle("Enable"), std::invalid_argument);
+        EXPECT_THROW(t->findString(strings.size()), std::invalid_argument);
+    }
+}
+
+TEST(BIOSEntryViews, testViews)
+{
+    using namespace pldm::bios::utils;
+
+    std::string hello = "Hello";
+    Table stringEntry(pldm_bios_table_string_entry_encode_length(hello.size()));
+    pldm_bios_table_string_entry_encode(stringEntry.data(), stringEntry.size(),
+                                        hello.c_str(), hello.size());
+    StringEntryView stringView(
+        reinterpret_cast<const pldm_bios_string_table_entry*>(
+            stringEntry.data()));
+    EXPECT_EQ(stringView.string(), hello);
+    EXPECT_EQ(stringView.handle(),
+              pldm_bios_table_string_entry_decode_handle(
+                  reinterpret_cast<const pldm_bios_string_table_entry*>(
+                      stringEntry.data())));
+
+    std::vector<uint16_t> pvHdls{2, 0x1234, 3};
+    std::vector<uint8_t> defIndices{2, 0};
+    pldm_bios_table_attr_entry_enum_info enumInfo = {
+        1,
+        true,
+        static_cast<uint8_t>(pvHdls.size()),
+        pvHdls.data(),
+        static_cast<uint8_t>(defIndices.size()),
+        defIndices.data()};
+    const char defString[] = "abc";
+    pldm_bios_table_attr_entry_string_info stringInfo = {
+        4, false, 1, 1, 100, 3, defString};
+    pldm_bios_table_attr_entry_integer_info integerInfo = {5, false, 1, 10,
+                                                           3, 4};
+    Table attrTable(4096);
+    pldm_bios_table_builder builder;
+    pldm_bios_table_builder_init(&builder, attrTable.data(), attrTable.size());
+    pldm_bios_table_builder_attr_enum_add(&builder, &enumInfo, nullptr);
+    pldm_bios_table_builder_attr_string_add(&builder, &stringInfo, nullptr);
+    pldm_bios_table_builder_attr_integer_add(&builder, &integerInfo, nullptr);
+    size_t length = 0;
+    ASSERT_EQ(pldm_bios_table_builder_finish(&builder, &length), PLDM_SUCCESS);
+    attrTable.resize(length);
+
+    std::vector<AttrEntryView> attrs;
+    for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(attrTable.data(),
+                                                         attrTable.size()))
+    {
+        attrs.emplace_back(entry);
+    }
+    ASSERT_EQ(attrs.size(), 3);
+
+    EXPECT_EQ(attrs[0].handle(), 0);
+    EXPECT_EQ(attrs[0].type(), PLDM_BIOS_ENUMERATION_READ_ONLY);
+    EXPECT_TRUE(attrs[0].readOnly());
+    EXPECT_EQ(attrs[0].nameHandle(), 1);
+    auto pvHandles = attrs[0].pvHandles();
+    EXPECT_TRUE(std::equal(pvHandles.begin(), pvHandles.end(), pvHdls.begin(),
+                           pvHdls.end()));
+    EXPECT_EQ(pvHandles[1], 0x1234);
+    auto defs = attrs[0].defIndices();
+    EXPECT_TRUE(std::equal(defs.begin(), defs.end(), defIndices.begin(),
+                           defIndices.end()));
+
+    EXPECT_EQ(attrs[1].type(), PLDM_BIOS_STRING);
+    EXPECT_FALSE(attrs[1].readOnly());
+    EXPECT_EQ(attrs[1].nameHandle(), 4);
+    EXPECT_EQ(attrs[1].stringType(), 1);
+    EXPECT_EQ(attrs[1].minLength(), 1);
+    EXPECT_EQ(attrs[1].maxLength(), 100);
+    EXPECT_EQ(attrs[1].defString(), defString);
+
+    EXPECT_EQ(attrs[2].type(), PLDM_BIOS_INTEGER);
+    auto integer = attrs[2].integer();
+    EXPECT_EQ(integer.lowerBound, 1);
+    EXPECT_EQ(integer.upperBound, 10);
+    EXPECT_EQ(integer.scalarIncrement, 3);
+    EXPECT_EQ(integer.defaultValue, 4);
+
+    std::vector<uint8_t> currIndices{1, 2};
+    Table enumValue(pldm_bios_table_attr_value_entry_encode_enum_length(
+        currIndices.size()));
+    pldm_bios_table_attr_value_entry_encode_enum(
+        enumValue.data(), enumValue.size(), 0, PLDM_BIOS_ENUMERATION,
+        currIndices.size(), currIndices.data());
+    AttrValueEntryView enumView(
+        reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+            enumValue.data()));
+    EXPECT_EQ(enumView.handle(), 0);
+    EXPECT_EQ(enumView.type(), PLDM_BIOS_ENUMERATION);
+    auto indices = enumView.currentIndices();
+    EXPECT_TRUE(std::equal(indices.begin(), indices.end(), currIndices.begin(),
+                           currIndices.end()));
+
+    std::string current = "current";
+    Table stringValue(
+        pldm_bios_table_attr_value_entry_encode_string_length(current.size()));
+    pldm_bios_table_attr_value_entry_encode_string(
+        stringValue.data(), stringValue.size(), 1, PLDM_BIOS_STRING,
+        current.size(), current.c_str());
+    EXPECT_EQ(AttrValueEntryView(
+                  reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+                      stringValue.data()))
+                  .currentString(),
+              current);
+
+    Table integerValue(
+        pldm_bios_table_attr_value_entry_encode_integer_length());
+    pldm_bios_table_attr_value_entry_encode_integer(
+        integerValue.data(), integerValue.size(), 2, PLDM_BIOS_INTEGER, 7);
+    EXPECT_EQ(AttrValueEntryView(
+                  reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+                      integerValue.data()))
+                  .currentValue(),
+              7);
+}
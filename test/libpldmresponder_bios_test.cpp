@@ -2,12 +2,17 @@
 #include "libpldmresponder/bios_parser.hpp"
 #include "libpldmresponder/bios_table.hpp"
 
+#include <endian.h>
 #include <string.h>
 
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstring>
 #include <ctime>
 #include <filesystem>
+#include <fstream>
+#include <memory>
 
 #include "libpldm/base.h"
 #include "libpldm/bios.h"
@@ -105,6 +110,38 @@ TEST(GetBIOSStrings, allScenarios)
     ASSERT_EQ(strings == vec, true);
 }
 
+TEST(GetBIOSStrings, resetConfig)
+{
+    namespace fs = std::filesystem;
+    char tmpdir[] = "/tmp/biosJsons.XXXXXX";
+    fs::path jsonsPath(mkdtemp(tmpdir));
+    fs::copy_file(fs::path("./bios_jsons") / bIOSEnumJson,
+                  jsonsPath / bIOSEnumJson);
+
+    resetConfig();
+    ASSERT_EQ(setupConfig(jsonsPath.c_str()), 0);
+    auto strings = getStrings();
+    EXPECT_NE(std::find(strings.begin(), strings.end(), "HMCManagedState"),
+              strings.end());
+    EXPECT_EQ(std::find(strings.begin(), strings.end(), "str_example1"),
+              strings.end());
+
+    // Parsed once until reset
+    fs::copy_file(fs::path("./bios_jsons") / bIOSStrJson,
+                  jsonsPath / bIOSStrJson);
+    setupConfig(jsonsPath.c_str());
+    EXPECT_EQ(getStrings(), strings);
+    resetConfig();
+    ASSERT_EQ(setupConfig(jsonsPath.c_str()), 0);
+    strings = getStrings();
+    EXPECT_NE(std::find(strings.begin(), strings.end(), "str_example1"),
+              strings.end());
+
+    resetConfig();
+    setupConfig("./bios_jsons");
+    fs::remove_all(jsonsPath);
+}
+
 TEST(getAttrValue, enumScenarios)
 {
     using namespace bios_parser::bios_enum;
@@ -223,18 +260,22 @@ class TestAllBIOSTables : public ::testing::Test
     {
         char tmpdir[] = "/tmp/allBIOSTables.XXXXXX";
         biosPath = fs::path(mkdtemp(tmpdir));
+        handler = std::make_unique<Handler>("./bios_jsons", biosPath.c_str());
     }
 
     static void TearDownTestCase() // will be executed once at th eend of all
                                    // TestAllBIOSTables objects
     {
+        handler.reset();
         fs::remove_all(biosPath);
     }
 
     static fs::path biosPath;
+    static std::unique_ptr<Handler> handler;
 };
 
 fs::path TestAllBIOSTables::biosPath;
+std::unique_ptr<Handler> TestAllBIOSTables::handler;
 
 TEST_F(TestAllBIOSTables, GetBIOSTableTestBadRequest)
 {
@@ -249,8 +290,7 @@ TEST_F(TestAllBIOSTables, GetBIOSTableTestBadRequest)
 
     size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
 
-    auto response = internal::buildBIOSTables(request, requestPayloadLength,
-                                              "./bios_jsons", biosPath.c_str());
+    auto response = handler->getBIOSTable(request, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
     struct pldm_get_bios_table_resp* resp =
@@ -273,8 +313,7 @@ TEST_F(TestAllBIOSTables, buildBIOSTablesTestBadRequest)
 
     size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
 
-    auto response = internal::buildBIOSTables(request, requestPayloadLength,
-                                              "./bios_jsons", biosPath.c_str());
+    auto response = handler->getBIOSTable(request, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
     struct pldm_get_bios_table_resp* resp =
         reinterpret_cast<struct pldm_get_bios_table_resp*>(
@@ -282,8 +321,7 @@ TEST_F(TestAllBIOSTables, buildBIOSTablesTestBadRequest)
     ASSERT_EQ(PLDM_BIOS_TABLE_UNAVAILABLE, resp->completion_code);
 
     req->table_type = PLDM_BIOS_ATTR_TABLE;
-    response = internal::buildBIOSTables(request, requestPayloadLength,
-                                         "./bios_jsons", biosPath.c_str());
+    response = handler->getBIOSTable(request, requestPayloadLength);
     responsePtr = reinterpret_cast<pldm_msg*>(response.data());
     resp = reinterpret_cast<struct pldm_get_bios_table_resp*>(
         responsePtr->payload);
@@ -310,8 +348,7 @@ TEST_F(TestAllBIOSTables, GetBIOSStringTableTestGoodRequest)
     uint8_t times = 0;
     while (times < 2)
     { // first time fresh table second time existing table
-        auto response = internal::buildBIOSTables(
-            request, requestPayloadLength, "./bios_jsons", biosPath.c_str());
+        auto response = handler->getBIOSTable(request, requestPayloadLength);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
         struct pldm_get_bios_table_resp* resp =
@@ -356,8 +393,7 @@ TEST_F(TestAllBIOSTables, getBIOSAttributeTableTestGoodRequest)
     uint8_t times = 0;
     while (times < 2)
     { // first time fresh table second time existing table
-        auto response = internal::buildBIOSTables(
-            request, requestPayloadLength, "./bios_jsons", biosPath.c_str());
+        auto response = handler->getBIOSTable(request, requestPayloadLength);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
         struct pldm_get_bios_table_resp* resp =
@@ -448,8 +484,7 @@ TEST_F(TestAllBIOSTables, getBIOSAttributeValueTableTestGoodRequest)
     uint8_t times = 0;
     while (times < 2)
     { // first time frest table second time existing table
-        auto response = internal::buildBIOSTables(
-            request, requestPayloadLength, "./bios_jsons", biosPath.c_str());
+        auto response = handler->getBIOSTable(request, requestPayloadLength);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
         struct pldm_get_bios_table_resp* resp =
@@ -546,16 +581,15 @@ TEST_F(TestSingleTypeBIOSTable, getBIOSAttributeValueTableBasedOnStringTypeTest)
     req->table_type = PLDM_BIOS_STRING_TABLE;
 
     size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
-    auto str_response =
-        internal::buildBIOSTables(request, requestPayloadLength, fpath, fpath);
+    Handler handler(fpath, fpath);
+    auto str_response = handler.getBIOSTable(request, requestPayloadLength);
 
     // Get attribute table with string json file only
     req->transfer_handle = 9;
     req->transfer_op_flag = PLDM_GET_FIRSTPART;
     req->table_type = PLDM_BIOS_ATTR_TABLE;
 
-    auto attr_response =
-        internal::buildBIOSTables(request, requestPayloadLength, fpath, fpath);
+    auto attr_response = handler.getBIOSTable(request, requestPayloadLength);
 
     // Get attribute value table with string type
     req->transfer_handle = 9;
@@ -565,8 +599,7 @@ TEST_F(TestSingleTypeBIOSTable, getBIOSAttributeValueTableBasedOnStringTypeTest)
     // Test attribute str_example3 here, which has no dbus
     for (uint8_t times = 0; times < 2; times++)
     { // first time first table second time existing table
-        auto response = internal::buildBIOSTables(request, requestPayloadLength,
-                                                  fpath, fpath);
+        auto response = handler.getBIOSTable(request, requestPayloadLength);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
         struct pldm_get_bios_table_resp* resp =
@@ -630,15 +663,15 @@ TEST_F(TestSingleTypeBIOSTable,
     req->table_type = PLDM_BIOS_STRING_TABLE;
 
     size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
-    internal::buildBIOSTables(request, requestPayloadLength, fpath, fpath);
+    Handler handler(fpath, fpath);
+    handler.getBIOSTable(request, requestPayloadLength);
 
     // Get attribute table with integer json file only
     req->transfer_handle = 9;
     req->transfer_op_flag = PLDM_GET_FIRSTPART;
     req->table_type = PLDM_BIOS_ATTR_TABLE;
 
-    auto attr_response =
-        internal::buildBIOSTables(request, requestPayloadLength, fpath, fpath);
+    auto attr_response = handler.getBIOSTable(request, requestPayloadLength);
 
     // Get attribute value table with integer type
     req->transfer_handle = 9;
@@ -648,8 +681,7 @@ TEST_F(TestSingleTypeBIOSTable,
     // Test attribute SBE_IMAGE_MINIMUM_VALID_ECS here, which has no dbus
     for (uint8_t times = 0; times < 2; times++)
     { // first time first table second time existing table
-        auto response = internal::buildBIOSTables(request, requestPayloadLength,
-                                                  fpath, fpath);
+        auto response = handler.getBIOSTable(request, requestPayloadLength);
         auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
         struct pldm_get_bios_table_resp* resp =
@@ -670,3 +702,245 @@ TEST_F(TestSingleTypeBIOSTable,
         EXPECT_EQ(2, cv);
     }
 }
+
+TEST_F(TestSingleTypeBIOSTable, reuseTablesTest)
+{
+    TestSingleTypeBIOSTable::CopySingleJsonFile(bios_parser::bIOSStrJson);
+    auto fpath = TestSingleTypeBIOSTable::destBIOSPath.c_str();
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_REQ_BYTES>
+        requestPayload{};
+    auto request = reinterpret_cast<pldm_msg*>(requestPayload.data());
+    struct pldm_get_bios_table_req* req =
+        (struct pldm_get_bios_table_req*)request->payload;
+    req->transfer_handle = 9;
+    req->transfer_op_flag = PLDM_GET_FIRSTPART;
+    size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
+
+    Response strResponse;
+    {
+        Handler handler(fpath, fpath);
+        req->table_type = PLDM_BIOS_STRING_TABLE;
+        strResponse = handler.getBIOSTable(request, requestPayloadLength);
+        req->table_type = PLDM_BIOS_ATTR_TABLE;
+        handler.getBIOSTable(request, requestPayloadLength);
+    }
+    auto attrTablePath = destBIOSPath / "attributeTable";
+    ASSERT_TRUE(fs::exists(attrTablePath));
+
+    // Same configuration, the tables are kept
+    req->table_type = PLDM_BIOS_STRING_TABLE;
+    auto response =
+        Handler(fpath, fpath).getBIOSTable(request, requestPayloadLength);
+    EXPECT_EQ(response, strResponse);
+    EXPECT_TRUE(fs::exists(attrTablePath));
+
+    // Changed configuration, the tables are built again
+    {
+        std::ofstream json(destBIOSPath / bios_parser::bIOSStrJson,
+                           std::ios::app);
+        json << "\n";
+    }
+    response =
+        Handler(fpath, fpath).getBIOSTable(request, requestPayloadLength);
+    EXPECT_EQ(response, strResponse);
+    EXPECT_FALSE(fs::exists(attrTablePath));
+}
+
+TEST_F(TestSingleTypeBIOSTable, persistAttrValuesTest)
+{
+    TestSingleTypeBIOSTable::CopySingleJsonFile(bios_parser::bIOSStrJson);
+    auto dir = TestSingleTypeBIOSTable::destBIOSPath.string();
+
+    auto getTable = [](Handler& handler, uint8_t tableType) {
+        std::array<uint8_t,
+                   sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_REQ_BYTES>
+            requestMsg{};
+        auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+        encode_get_bios_table_req(0, 0, PLDM_GET_FIRSTPART, tableType,
+                                  request);
+        auto response =
+            handler.getBIOSTable(request, PLDM_GET_BIOS_TABLE_REQ_BYTES);
+        auto tableOffset = sizeof(pldm_msg_hdr) +
+                           offsetof(pldm_get_bios_table_resp, table_data);
+        EXPECT_GT(response.size(), tableOffset);
+        return Table(response.begin() + tableOffset, response.end());
+    };
+    auto getValue = [](Handler& handler, uint16_t attrHandle) {
+        std::array<uint8_t,
+                   sizeof(pldm_msg_hdr) +
+                       PLDM_GET_BIOS_ATTR_CURR_VAL_BY_HANDLE_REQ_BYTES>
+            requestMsg{};
+        auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+        auto req = reinterpret_cast<
+            pldm_get_bios_attribute_current_value_by_handle_req*>(
+            request->payload);
+        req->transfer_op_flag = PLDM_GET_FIRSTPART;
+        req->attribute_handle = htole16(attrHandle);
+        auto response = handler.getBIOSAttributeCurrentValueByHandle(
+            request, PLDM_GET_BIOS_ATTR_CURR_VAL_BY_HANDLE_REQ_BYTES);
+        auto entryOffset = sizeof(pldm_msg_hdr) +
+                           PLDM_GET_BIOS_ATTR_CURR_VAL_BY_HANDLE_MIN_RESP_BYTES;
+        if (response.size() <= entryOffset)
+        {
+            return std::string();
+        }
+        auto entry = reinterpret_cast<const pldm_bios_attr_val_table_entry*>(
+            response.data() + entryOffset);
+        variable_field value;
+        pldm_bios_table_attr_value_entry_string_decode_string(entry, &value);
+        return std::string(reinterpret_cast<const char*>(value.ptr),
+                           value.length);
+    };
+    auto encodeString = [](uint16_t handle, const std::string& str) {
+        Table entry(
+            pldm_bios_table_attr_value_entry_encode_string_length(str.size()));
+        pldm_bios_table_attr_value_entry_encode_string(
+            entry.data(), entry.size(), handle, PLDM_BIOS_STRING, str.size(),
+            str.c_str());
+        return entry;
+    };
+
+    uint16_t attrHandle = 0;
+    {
+        Handler handler(dir, dir);
+        BIOSStringTable stringTable(
+            getTable(handler, PLDM_BIOS_STRING_TABLE));
+        auto attrTable = getTable(handler, PLDM_BIOS_ATTR_TABLE);
+        auto nameHandle = stringTable.findHandle("str_example1");
+        traverseBIOSAttrTable(attrTable, [&](const auto* entry) {
+            if (pldm_bios_table_attr_entry_decode_string_handle(entry) ==
+                nameHandle)
+            {
+                attrHandle =
+                    pldm_bios_table_attr_entry_decode_attribute_handle(entry);
+            }
+        });
+        // The D-Bus property of str_example1 can't be read here
+        EXPECT_EQ(getValue(handler, attrHandle), "");
+    }
+
+    // As persisted by a run that could read it
+    fs::path valueTablePath(destBIOSPath / "attributeValueTable");
+    auto table = encodeString(attrHandle, "abc");
+    auto size = table.size();
+    table.resize(size + pldm_bios_table_pad_checksum_size(size));
+    pldm_bios_table_append_pad_checksum(table.data(), table.size(), size);
+    BIOSTable(valueTablePath.c_str()).store(table);
+    auto entry = encodeString(attrHandle, "xyz");
+    BIOSValueJournal(valueTablePath).append(entry.data(), entry.size());
+
+    {
+        Handler handler(dir, dir);
+        EXPECT_EQ(getValue(handler, attrHandle), "xyz");
+    }
+    // The table built from the persisted one leaves them as they are
+    Handler handler(dir, dir);
+    EXPECT_EQ(getValue(handler, attrHandle), "xyz");
+}
+
+TEST_F(TestSingleTypeBIOSTable, setBIOSAttributeBadEntryTest)
+{
+    TestSingleTypeBIOSTable::CopySingleJsonFile(bios_parser::bIOSStrJson);
+    auto dir = TestSingleTypeBIOSTable::destBIOSPath.string();
+    Handler handler(dir, dir);
+
+    auto getTable = [&handler](uint8_t tableType) {
+        std::array<uint8_t,
+                   sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_REQ_BYTES>
+            requestMsg{};
+        auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+        encode_get_bios_table_req(0, 0, PLDM_GET_FIRSTPART, tableType,
+                                  request);
+        return handler.getBIOSTable(request, PLDM_GET_BIOS_TABLE_REQ_BYTES);
+    };
+    auto setValue = [&handler](const std::vector<uint8_t>& entry) {
+        auto payloadLength =
+            PLDM_SET_BIOS_ATTR_CURR_VAL_MIN_REQ_BYTES + entry.size();
+        std::vector<uint8_t> requestMsg(sizeof(pldm_msg_hdr) + payloadLength);
+        auto request = reinterpret_cast<pldm_msg*>(requestMsg.data());
+        encode_set_bios_attribute_current_value_req(
+            0, 0, PLDM_START_AND_END, entry.data(), entry.size(), request,
+            payloadLength);
+        auto response =
+            handler.setBIOSAttributeCurrentValue(request, payloadLength);
+        return reinterpret_cast<pldm_msg*>(response.data())->payload[0];
+    };
+
+    getTable(PLDM_BIOS_STRING_TABLE);
+    getTable(PLDM_BIOS_ATTR_TABLE);
+    auto valueTable = getTable(PLDM_BIOS_ATTR_VAL_TABLE);
+
+    std::vector<uint8_t> unknownEntry{
+        0,    0, /* attr handle */
+        0x42,    /* attr type */
+        0,    0, 0, 0,
+    };
+    EXPECT_EQ(setValue(unknownEntry), PLDM_ERROR_INVALID_DATA);
+
+    std::vector<uint8_t> truncatedEntry{
+        0, 0,             /* attr handle */
+        PLDM_BIOS_STRING, /* attr type */
+        9,                /* first byte of the current string length */
+    };
+    EXPECT_EQ(setValue(truncatedEntry), PLDM_ERROR_INVALID_LENGTH);
+
+    EXPECT_EQ(getTable(PLDM_BIOS_ATTR_VAL_TABLE), valueTable);
+}
+
+TEST_F(TestSingleTypeBIOSTable, setAttributeValueOnDbusTest)
+{
+    TestSingleTypeBIOSTable::CopySingleJsonFile(bios_parser::bIOSStrJson);
+    auto fpath = TestSingleTypeBIOSTable::destBIOSPath.c_str();
+
+    std::array<uint8_t, sizeof(pldm_msg_hdr) + PLDM_GET_BIOS_TABLE_REQ_BYTES>
+        requestPayload{};
+    auto request = reinterpret_cast<pldm_msg*>(requestPayload.data());
+    struct pldm_get_bios_table_req* req =
+        (struct pldm_get_bios_table_req*)request->payload;
+    req->transfer_handle = 9;
+    req->transfer_op_flag = PLDM_GET_FIRSTPART;
+    size_t requestPayloadLength = requestPayload.size() - sizeof(pldm_msg_hdr);
+    {
+        Handler handler(fpath, fpath);
+        req->table_type = PLDM_BIOS_STRING_TABLE;
+        handler.getBIOSTable(request, requestPayloadLength);
+        req->table_type = PLDM_BIOS_ATTR_TABLE;
+        handler.getBIOSTable(request, requestPayloadLength);
+    }
+
+    BIOSStringTable stringTable(
+        BIOSTable((destBIOSPath / "stringTable").c_str()));
+    Table attrTable;
+    BIOSTable((destBIOSPath / "attributeTable").c_str()).load(attrTable);
+    indexAttrTable(attrTable, stringTable);
+
+    auto encodeString = [](uint16_t handle, const std::string& str) {
+        Table entry(
+            pldm_bios_table_attr_value_entry_encode_string_length(str.size()));
+        pldm_bios_table_attr_value_entry_encode_string(
+            entry.data(), entry.size(), handle, PLDM_BIOS_STRING, str.size(),
+            str.c_str());
+        return entry;
+    };
+
+    // str_example3 has no D-Bus property, there is nothing to set
+    auto nameHandle = stringTable.findHandle("str_example3");
+    const pldm_bios_attr_table_entry* attrEntry = nullptr;
+    traverseBIOSAttrTable(attrTable, [&](const auto* entry) {
+        if (pldm_bios_table_attr_entry_decode_string_handle(entry) ==
+            nameHandle)
+        {
+            attrEntry = entry;
+        }
+    });
+    ASSERT_NE(attrEntry, nullptr);
+    auto entry = encodeString(
+        pldm_bios_table_attr_entry_decode_attribute_handle(attrEntry), "abc");
+    variable_field field{entry.data(), entry.size()};
+    EXPECT_EQ(setAttributeValueOnDbus(&field), PLDM_SUCCESS);
+
+    entry = encodeString(0xfff0, "abc");
+    field = {entry.data(), entry.size()};
+    EXPECT_EQ(setAttributeValueOnDbus(&field), PLDM_ERROR);
+}
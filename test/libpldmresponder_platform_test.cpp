@@ -24,9 +24,8 @@ TEST(getPDR, testGoodPath)
         reinterpret_cast<struct pldm_get_pdr_req*>(req->payload);
     request->request_count = 100;
 
-    auto pdrRepo = pldm_pdr_init();
-    Handler handler("./pdr_jsons/state_effecter/good", pdrRepo);
-    Repo repo(pdrRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto repo = handler.getRepo().getSnapshot();
     ASSERT_EQ(repo.empty(), false);
     auto response = handler.getPDR(req, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
@@ -40,8 +39,6 @@ TEST(getPDR, testGoodPath)
     pldm_pdr_hdr* hdr = reinterpret_cast<pldm_pdr_hdr*>(resp->record_data);
     ASSERT_EQ(hdr->record_handle, 1);
     ASSERT_EQ(hdr->version, 1);
-
-    pldm_pdr_destroy(pdrRepo);
 }
 
 TEST(getPDR, testShortRead)
@@ -55,9 +52,8 @@ TEST(getPDR, testShortRead)
         reinterpret_cast<struct pldm_get_pdr_req*>(req->payload);
     request->request_count = 1;
 
-    auto pdrRepo = pldm_pdr_init();
-    Handler handler("./pdr_jsons/state_effecter/good", pdrRepo);
-    Repo repo(pdrRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto repo = handler.getRepo().getSnapshot();
     ASSERT_EQ(repo.empty(), false);
     auto response = handler.getPDR(req, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
@@ -65,7 +61,6 @@ TEST(getPDR, testShortRead)
         reinterpret_cast<struct pldm_get_pdr_resp*>(responsePtr->payload);
     ASSERT_EQ(PLDM_SUCCESS, resp->completion_code);
     ASSERT_EQ(1, resp->response_count);
-    pldm_pdr_destroy(pdrRepo);
 }
 
 TEST(getPDR, testBadRecordHandle)
@@ -80,16 +75,13 @@ TEST(getPDR, testBadRecordHandle)
     request->record_handle = 100000;
     request->request_count = 1;
 
-    auto pdrRepo = pldm_pdr_init();
-    Handler handler("./pdr_jsons/state_effecter/good", pdrRepo);
-    Repo repo(pdrRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto repo = handler.getRepo().getSnapshot();
     ASSERT_EQ(repo.empty(), false);
     auto response = handler.getPDR(req, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
 
     ASSERT_EQ(responsePtr->payload[0], PLDM_PLATFORM_INVALID_RECORD_HANDLE);
-
-    pldm_pdr_destroy(pdrRepo);
 }
 
 TEST(getPDR, testNoNextRecord)
@@ -103,9 +95,8 @@ TEST(getPDR, testNoNextRecord)
         reinterpret_cast<struct pldm_get_pdr_req*>(req->payload);
     request->record_handle = 1;
 
-    auto pdrRepo = pldm_pdr_init();
-    Handler handler("./pdr_jsons/state_effecter/good", pdrRepo);
-    Repo repo(pdrRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto repo = handler.getRepo().getSnapshot();
     ASSERT_EQ(repo.empty(), false);
     auto response = handler.getPDR(req, requestPayloadLength);
     auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
@@ -113,8 +104,6 @@ TEST(getPDR, testNoNextRecord)
         reinterpret_cast<struct pldm_get_pdr_resp*>(responsePtr->payload);
     ASSERT_EQ(PLDM_SUCCESS, resp->completion_code);
     ASSERT_EQ(2, resp->next_record_handle);
-
-    pldm_pdr_destroy(pdrRepo);
 }
 
 TEST(getPDR, testFindPDR)
@@ -128,9 +117,8 @@ TEST(getPDR, testFindPDR)
         reinterpret_cast<struct pldm_get_pdr_req*>(req->payload);
     request->request_count = 100;
 
-    auto pdrRepo = pldm_pdr_init();
-    Handler handler("./pdr_jsons/state_effecter/good", pdrRepo);
-    Repo repo(pdrRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto repo = handler.getRepo().getSnapshot();
     ASSERT_EQ(repo.empty(), false);
     auto response = handler.getPDR(req, requestPayloadLength);
 
@@ -171,8 +159,6 @@ TEST(getPDR, testFindPDR)
         }
     }
     ASSERT_EQ(found, true);
-
-    pldm_pdr_destroy(pdrRepo);
 }
 
 namespace pldm
@@ -197,11 +183,10 @@ using ::testing::Return;
 
 TEST(setStateEffecterStatesHandler, testGoodRequest)
 {
-    auto inPDRRepo = pldm_pdr_init();
     auto outPDRRepo = pldm_pdr_init();
     Repo outRepo(outPDRRepo);
-    Handler handler("./pdr_jsons/state_effecter/good", inPDRRepo);
-    Repo inRepo(inPDRRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto inRepo = handler.getRepo().getSnapshot();
     getRepoByType(inRepo, outRepo, PLDM_STATE_EFFECTER_PDR);
     pdr_utils::PdrEntry e;
     auto record1 = pdr::getRecordByHandle(outRepo, 1, e);
@@ -228,17 +213,15 @@ TEST(setStateEffecterStatesHandler, testGoodRequest)
         handlerObj, 0x1, stateField);
     ASSERT_EQ(rc, 0);
 
-    pldm_pdr_destroy(inPDRRepo);
     pldm_pdr_destroy(outPDRRepo);
 }
 
 TEST(setStateEffecterStatesHandler, testBadRequest)
 {
-    auto inPDRRepo = pldm_pdr_init();
     auto outPDRRepo = pldm_pdr_init();
     Repo outRepo(outPDRRepo);
-    Handler handler("./pdr_jsons/state_effecter/good", inPDRRepo);
-    Repo inRepo(inPDRRepo);
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto inRepo = handler.getRepo().getSnapshot();
     getRepoByType(inRepo, outRepo, PLDM_STATE_EFFECTER_PDR);
     pdr_utils::PdrEntry e;
     auto record1 = pdr::getRecordByHandle(outRepo, 1, e);
@@ -272,6 +255,122 @@ TEST(setStateEffecterStatesHandler, testBadRequest)
                                                                 newStateField);
     ASSERT_EQ(rc, PLDM_PLATFORM_INVALID_STATE_VALUE);
 
-    pldm_pdr_destroy(inPDRRepo);
     pldm_pdr_destroy(outPDRRepo);
 }
+
+TEST(getPDRRepositoryInfo, testGoodPath)
+{
+    std::array<uint8_t, sizeof(pldm_msg_hdr)> requestMsg{};
+    auto req = reinterpret_cast<pldm_msg*>(requestMsg.data());
+
+    Handler handler("./pdr_jsons/state_effecter/good");
+    auto response = handler.getPDRRepositoryInfo(req, 0);
+    auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+
+    uint8_t completionCode{};
+    uint8_t repositoryState{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> updateTime{};
+    std::array<uint8_t, PLDM_TIMESTAMP104_SIZE> oemUpdateTime{};
+    uint32_t recordCount{};
+    uint32_t repositorySize{};
+    uint32_t largestRecordSize{};
+    uint8_t timeout{};
+    auto rc = decode_get_pdr_repository_info_resp(
+        responsePtr, response.size() - sizeof(pldm_msg_hdr), &completionCode,
+        &repositoryState, updateTime.data(), oemUpdateTime.data(),
+        &recordCount, &repositorySize, &largestRecordSize, &timeout);
+    ASSERT_EQ(rc, PLDM_SUCCESS);
+    ASSERT_EQ(completionCode, PLDM_SUCCESS);
+    ASSERT_EQ(repositoryState, PLDM_PDR_REPOSITORY_AVAILABLE);
+    auto repo = handler.getRepo().getSnapshot();
+    ASSERT_EQ(recordCount, pldm_pdr_get_record_count(repo.getPdr()));
+    ASSERT_EQ(repositorySize, pldm_pdr_get_repo_size(repo.getPdr()));
+    ASSERT_EQ(largestRecordSize,
+              pldm_pdr_get_largest_record_size(repo.getPdr()));
+    ASSERT_NE(updateTime[12], 0);
+
+    response = handler.getPDRRepositoryInfo(req, 1);
+    responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+    ASSERT_EQ(responsePtr->payload[0], PLDM_ERROR_INVALID_LENGTH);
+}
+
+TEST(getPDRRepositorySignature, testSignatureChange)
+{
+    std::array<uint8_t, sizeof(pldm_msg_hdr)> requestMsg{};
+    auto req = reinterpret_cast<pldm_msg*>(requestMsg.data());
+
+    Handler handler("./pdr_jsons/state_effecter/good");
+
+    auto getSignature = [&]() {
+        auto response = handler.getPDRRepositorySignature(req, 0);
+        auto responsePtr = reinterpret_cast<pldm_msg*>(response.data());
+        uint8_t completionCode{};
+        uint32_t signature{};
+        auto rc = decode_get_pdr_repository_signature_resp(
+            responsePtr, response.size() - sizeof(pldm_msg_hdr),
+            &completionCode, &signature);
+        EXPECT_EQ(rc, PLDM_SUCCESS);
+        EXPECT_EQ(completionCode, PLDM_SUCCESS);
+        return signature;
+    };
+
+    auto signature = getSignature();
+    ASSERT_NE(signature, 0);
+    ASSERT_EQ(getSignature(), signature);
+
+    std::array<uint8_t, sizeof(pldm_pdr_hdr)> data{};
+    handler.getRepo().update([&data](Repo& repo) {
+        PdrEntry e{};
+        e.data = data.data();
+        e.size = data.size();
+        repo.addRecord(e);
+    });
+    ASSERT_NE(getSignature(), signature);
+}
+
+TEST(VersionedRepo, testSnapshot)
+{
+    VersionedRepo versionedRepo;
+    auto initial = versionedRepo.getSnapshot();
+    ASSERT_EQ(initial.empty(), true);
+    ASSERT_EQ(versionedRepo.getVersion(), 0);
+
+    std::array<uint8_t, sizeof(pldm_pdr_hdr)> data{};
+    auto version = versionedRepo.update([&data](Repo& repo) {
+        PdrEntry e{};
+        e.data = data.data();
+        e.size = data.size();
+        repo.addRecord(e);
+    });
+    ASSERT_EQ(version, 1);
+
+    auto first = versionedRepo.getSnapshot();
+    ASSERT_EQ(first.getRecordCount(), 1);
+    // Snapshots taken before an update are not affected by it
+    ASSERT_EQ(initial.empty(), true);
+
+    versionedRepo.update([&data](Repo& repo) {
+        PdrEntry e{};
+        e.data = data.data();
+        e.size = data.size();
+        repo.addRecord(e);
+    });
+    ASSERT_EQ(first.getRecordCount(), 1);
+
+    auto second = versionedRepo.getSnapshot();
+    ASSERT_EQ(second.getRecordCount(), 2);
+    PdrEntry e{};
+    auto record = pdr::getRecordByHandle(second, 2, e);
+    ASSERT_NE(record, nullptr);
+    ASSERT_EQ(e.handle.nextRecordHandle, 0);
+    ASSERT_EQ(reinterpret_cast<pldm_pdr_hdr*>(e.data)->record_handle, 2);
+
+    // The signature is published with the version it was computed for
+    ASSERT_EQ(second.getSignature(), pldm_pdr_get_signature(second.getPdr()));
+    ASSERT_NE(second.getSignature(), first.getSignature());
+    // An update that changes no record keeps the update time
+    versionedRepo.update([](Repo&) {});
+    auto third = versionedRepo.getSnapshot();
+    ASSERT_EQ(third.getSignature(), second.getSignature());
+    ASSERT_EQ(third.getUpdateTime(), second.getUpdateTime());
+}
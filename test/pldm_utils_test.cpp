@@ -77,3 +77,45 @@ TEST(parseEffecterData, testBadDecodeEffecterData)
 
     EXPECT_EQ(effecterField, std::nullopt);
 }
+
+TEST(ServiceCache, testFindInsert)
+{
+    ServiceCache cache(2);
+    EXPECT_EQ(cache.find("/a", "x.A"), std::nullopt);
+
+    cache.insert("/a", "x.A", "svc.One");
+    cache.insert("/a", "x.B", "svc.Two");
+    EXPECT_EQ(cache.find("/a", "x.A"), "svc.One");
+    EXPECT_EQ(cache.find("/a", "x.B"), "svc.Two");
+
+    // /a x.A is the least recently used
+    cache.insert("/b", "x.A", "svc.One");
+    EXPECT_EQ(cache.find("/a", "x.A"), std::nullopt);
+    EXPECT_EQ(cache.find("/a", "x.B"), "svc.Two");
+    EXPECT_EQ(cache.find("/b", "x.A"), "svc.One");
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 4);
+    EXPECT_EQ(stats.misses, 2);
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_EQ(stats.size, 2);
+}
+
+TEST(ServiceCache, testErase)
+{
+    ServiceCache cache;
+    cache.insert("/a", "x.A", "svc.One");
+    cache.insert("/a", "x.B", "svc.Two");
+    cache.insert("/a/b", "x.A", "svc.One");
+    cache.insert("/b", "x.B", "svc.Two");
+
+    cache.erasePath("/a");
+    EXPECT_EQ(cache.find("/a", "x.A"), std::nullopt);
+    EXPECT_EQ(cache.find("/a", "x.B"), std::nullopt);
+    EXPECT_EQ(cache.find("/a/b", "x.A"), "svc.One");
+
+    cache.eraseService("svc.Two");
+    EXPECT_EQ(cache.find("/b", "x.B"), std::nullopt);
+    EXPECT_EQ(cache.find("/a/b", "x.A"), "svc.One");
+    EXPECT_EQ(cache.stats().size, 1);
+}
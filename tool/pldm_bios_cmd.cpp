@@ -232,6 +232,18 @@ class GetBIOSTable : public CommandInterface
             reinterpret_cast<char*>((responsePtr->payload) + bios_table_offset);
         auto tableSize = payloadLength - sizeof(nextTransferHandle) -
                          sizeof(transferFlag) - sizeof(cc);
+
+        pldm_bios_table_validation report{};
+        rc = pldm_bios_table_validate(tableData, tableSize, tableType, nullptr,
+                                      0, &report);
+        if (rc != PLDM_SUCCESS)
+        {
+            std::cerr << "GetBIOSTable Validation Error: tableType="
+                      << tableType << ", defect=" << report.defect
+                      << ", offset=" << report.offset
+                      << ", handle=" << report.handle << std::endl;
+            return std::nullopt;
+        }
         return std::make_optional<Table>(tableData, tableData + tableSize);
     }
 
@@ -250,6 +262,7 @@ class GetBIOSTable : public CommandInterface
             {
                 auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
                 auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
+                createIndexes(stringTable, attrTable);
 
                 decodeAttributeTable(attrTable, stringTable);
             }
@@ -259,6 +272,7 @@ class GetBIOSTable : public CommandInterface
                 auto stringTable = getBIOSTable(PLDM_BIOS_STRING_TABLE);
                 auto attrTable = getBIOSTable(PLDM_BIOS_ATTR_TABLE);
                 auto attrValTable = getBIOSTable(PLDM_BIOS_ATTR_VAL_TABLE);
+                createIndexes(stringTable, attrTable);
 
                 decodeAttributeValueTable(attrValTable, attrTable, stringTable);
                 break;
@@ -268,6 +282,24 @@ class GetBIOSTable : public CommandInterface
 
   private:
     pldm_bios_table_types pldmBIOSTableType;
+    std::optional<BIOSTableIndex<PLDM_BIOS_STRING_TABLE>> stringTableIndex;
+    std::optional<BIOSTableIndex<PLDM_BIOS_ATTR_TABLE>> attrTableIndex;
+
+    /** @brief Index the string and attribute tables by handle, the tables
+     *         are looked up for every entry of the table being decoded
+     */
+    void createIndexes(const std::optional<Table>& stringTable,
+                       const std::optional<Table>& attrTable)
+    {
+        if (stringTable)
+        {
+            stringTableIndex.emplace(stringTable->data(), stringTable->size());
+        }
+        if (attrTable)
+        {
+            attrTableIndex.emplace(attrTable->data(), attrTable->size());
+        }
+    }
 
     static inline const std::map<pldm_bios_attribute_type, const char*>
         attrTypeMap = {
@@ -282,18 +314,6 @@ class GetBIOSTable : public CommandInterface
 
         };
 
-    std::string decodeStringFromStringEntry(
-        const pldm_bios_string_table_entry* stringEntry)
-    {
-        auto strLength =
-            pldm_bios_table_string_entry_decode_string_length(stringEntry);
-        std::vector<char> buffer(strLength + 1 /* sizeof '\0' */);
-        pldm_bios_table_string_entry_decode_string(stringEntry, buffer.data(),
-                                                   buffer.size());
-
-        return std::string(buffer.data(), buffer.data() + strLength);
-    }
-
     std::string displayStringHandle(uint16_t handle,
                                     const std::optional<Table>& stringTable)
     {
@@ -302,15 +322,20 @@ class GetBIOSTable : public CommandInterface
         {
             return displayString;
         }
-        auto stringEntry = pldm_bios_table_string_find_by_handle(
-            stringTable->data(), stringTable->size(), handle);
+        auto stringEntry =
+            stringTableIndex
+                ? stringTableIndex->find(stringTable->data(),
+                                         stringTable->size(), handle)
+                : pldm_bios_table_string_find_by_handle(
+                      stringTable->data(), stringTable->size(), handle);
         if (stringEntry == nullptr)
         {
             return displayString;
         }
 
-        return displayString + "(" + decodeStringFromStringEntry(stringEntry) +
-               ")";
+        displayString += "(";
+        displayString += StringEntryView(stringEntry).string();
+        return displayString + ")";
     }
 
     std::string displayEnumValueByIndex(uint16_t attrHandle, uint8_t index,
@@ -323,16 +348,21 @@ class GetBIOSTable : public CommandInterface
             return displayString;
         }
 
-        auto attrEntry = pldm_bios_table_attr_find_by_handle(
-            attrTable->data(), attrTable->size(), attrHandle);
+        auto attrEntry =
+            attrTableIndex
+                ? attrTableIndex->find(attrTable->data(), attrTable->size(),
+                                       attrHandle)
+                : pldm_bios_table_attr_find_by_handle(
+                      attrTable->data(), attrTable->size(), attrHandle);
         if (attrEntry == nullptr)
         {
             return displayString;
         }
-        auto pvNum = pldm_bios_table_attr_entry_enum_decode_pv_num(attrEntry);
-        std::vector<uint16_t> pvHandls(pvNum);
-        pldm_bios_table_attr_entry_enum_decode_pv_hdls(
-            attrEntry, pvHandls.data(), pvHandls.size());
+        auto pvHandls = AttrEntryView(attrEntry).pvHandles();
+        if (index >= pvHandls.size())
+        {
+            return displayString;
+        }
         return displayStringHandle(pvHandls[index], stringTable);
     }
 
@@ -350,10 +380,9 @@ class GetBIOSTable : public CommandInterface
         for (auto tableEntry : BIOSTableIter<PLDM_BIOS_STRING_TABLE>(
                  stringTable->data(), stringTable->size()))
         {
-            auto strHandle =
-                pldm_bios_table_string_entry_decode_handle(tableEntry);
-            auto strTableData = decodeStringFromStringEntry(tableEntry);
-            std::cout << strHandle << " : " << strTableData << std::endl;
+            StringEntryView entry(tableEntry);
+            std::cout << entry.handle() << " : " << entry.string()
+                      << std::endl;
         }
     }
     void decodeAttributeTable(const std::optional<Table>& attrTable,
@@ -366,18 +395,14 @@ class GetBIOSTable : public CommandInterface
             return;
         }
         std::cout << "PLDM AttributeTable: " << std::endl;
-        for (auto entry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
+        for (auto tableEntry : BIOSTableIter<PLDM_BIOS_ATTR_TABLE>(
                  attrTable->data(), attrTable->size()))
         {
-            auto attrHandle =
-                pldm_bios_table_attr_entry_decode_attribute_handle(entry);
-            auto attrNameHandle =
-                pldm_bios_table_attr_entry_decode_string_handle(entry);
-            auto attrType = static_cast<pldm_bios_attribute_type>(
-                pldm_bios_table_attr_entry_decode_attribute_type(entry));
-            std::cout << "AttributeHandle: " << attrHandle
+            AttrEntryView entry(tableEntry);
+            auto attrType = static_cast<pldm_bios_attribute_type>(entry.type());
+            std::cout << "AttributeHandle: " << entry.handle()
                       << ", AttributeNameHandle: "
-                      << displayStringHandle(attrNameHandle, stringTable)
+                      << displayStringHandle(entry.nameHandle(), stringTable)
                       << std::endl;
             std::cout << "\tAttributeType: " << attrTypeMap.at(attrType)
                       << std::endl;
@@ -386,18 +411,10 @@ class GetBIOSTable : public CommandInterface
                 case PLDM_BIOS_ENUMERATION:
                 case PLDM_BIOS_ENUMERATION_READ_ONLY:
                 {
-                    auto pvNum =
-                        pldm_bios_table_attr_entry_enum_decode_pv_num(entry);
-                    std::vector<uint16_t> pvHandls(pvNum);
-                    pldm_bios_table_attr_entry_enum_decode_pv_hdls(
-                        entry, pvHandls.data(), pvHandls.size());
-                    auto defNum =
-                        pldm_bios_table_attr_entry_enum_decode_def_num(entry);
-                    std::vector<uint8_t> defIndices(defNum);
-                    pldm_bios_table_attr_entry_enum_decode_def_indices(
-                        entry, defIndices.data(), defIndices.size());
-                    std::cout << "\tNumberOfPossibleValues: " << (int)pvNum
-                              << std::endl;
+                    auto pvHandls = entry.pvHandles();
+                    auto defIndices = entry.defIndices();
+                    std::cout << "\tNumberOfPossibleValues: "
+                              << pvHandls.size() << std::endl;
 
                     for (size_t i = 0; i < pvHandls.size(); i++)
                     {
@@ -407,58 +424,51 @@ class GetBIOSTable : public CommandInterface
                             << displayStringHandle(pvHandls[i], stringTable)
                             << std::endl;
                     }
-                    std::cout << "\tNumberOfDefaultValues: " << (int)defNum
-                              << std::endl;
+                    std::cout << "\tNumberOfDefaultValues: "
+                              << defIndices.size() << std::endl;
                     for (size_t i = 0; i < defIndices.size(); i++)
                     {
                         std::cout << "\t\tDefaultValueStringHandleIndex"
-                                  << "[" << i << "] = " << (int)defIndices[i]
-                                  << ", StringHandle = "
-                                  << displayStringHandle(
-                                         pvHandls[defIndices[i]], stringTable)
-                                  << std::endl;
+                                  << "[" << i << "] = " << (int)defIndices[i];
+                        if (defIndices[i] < pvHandls.size())
+                        {
+                            std::cout << ", StringHandle = "
+                                      << displayStringHandle(
+                                             pvHandls[defIndices[i]],
+                                             stringTable);
+                        }
+                        std::cout << std::endl;
                     }
                     break;
                 }
                 case PLDM_BIOS_INTEGER:
                 case PLDM_BIOS_INTEGER_READ_ONLY:
                 {
-                    uint64_t lower, upper, def;
-                    uint32_t scalar;
-                    pldm_bios_table_attr_entry_integer_decode(
-                        entry, &lower, &upper, &scalar, &def);
-                    std::cout << "\tLowerBound: " << lower << std::endl
-                              << "\tUpperBound: " << upper << std::endl
-                              << "\tScalarIncrement: " << scalar << std::endl
-                              << "\tDefaultValue: " << def << std::endl;
+                    auto integer = entry.integer();
+                    std::cout
+                        << "\tLowerBound: " << integer.lowerBound << std::endl
+                        << "\tUpperBound: " << integer.upperBound << std::endl
+                        << "\tScalarIncrement: " << integer.scalarIncrement
+                        << std::endl
+                        << "\tDefaultValue: " << integer.defaultValue
+                        << std::endl;
                     break;
                 }
                 case PLDM_BIOS_STRING:
                 case PLDM_BIOS_STRING_READ_ONLY:
                 {
-                    auto strType =
-                        pldm_bios_table_attr_entry_string_decode_string_type(
-                            entry);
-                    auto min =
-                        pldm_bios_table_attr_entry_string_decode_min_length(
-                            entry);
-                    auto max =
-                        pldm_bios_table_attr_entry_string_decode_max_length(
-                            entry);
-                    auto def =
-                        pldm_bios_table_attr_entry_string_decode_def_string_length(
-                            entry);
-                    std::vector<char> defString(def + 1);
-                    pldm_bios_table_attr_entry_string_decode_def_string(
-                        entry, defString.data(), defString.size());
+                    auto defString = entry.defString();
                     std::cout
                         << "\tStringType: 0x" << std::hex << std::setw(2)
-                        << std::setfill('0') << (int)strType << std::dec
-                        << std::setw(0) << std::endl
-                        << "\tMinimumStringLength: " << (int)min << std::endl
-                        << "\tMaximumStringLength: " << (int)max << std::endl
-                        << "\tDefaultStringLength: " << (int)def << std::endl
-                        << "\tDefaultString: " << defString.data() << std::endl;
+                        << std::setfill('0') << (int)entry.stringType()
+                        << std::dec << std::setw(0) << std::endl
+                        << "\tMinimumStringLength: " << entry.minLength()
+                        << std::endl
+                        << "\tMaximumStringLength: " << entry.maxLength()
+                        << std::endl
+                        << "\tDefaultStringLength: " << defString.size()
+                        << std::endl
+                        << "\tDefaultString: " << defString << std::endl;
                     break;
                 }
                 case PLDM_BIOS_PASSWORD:
@@ -482,12 +492,9 @@ class GetBIOSTable : public CommandInterface
         for (auto tableEntry : BIOSTableIter<PLDM_BIOS_ATTR_VAL_TABLE>(
                  attrValTable->data(), attrValTable->size()))
         {
-            auto attrHandle =
-                pldm_bios_table_attr_value_entry_decode_attribute_handle(
-                    tableEntry);
-            auto attrType = static_cast<pldm_bios_attribute_type>(
-                pldm_bios_table_attr_value_entry_decode_attribute_type(
-                    tableEntry));
+            AttrValueEntryView entry(tableEntry);
+            auto attrHandle = entry.handle();
+            auto attrType = static_cast<pldm_bios_attribute_type>(entry.type());
             std::cout << "AttributeHandle: " << attrHandle << std::endl;
             std::cout << "\tAttributeType: " << attrTypeMap.at(attrType)
                       << std::endl;
@@ -496,14 +503,8 @@ class GetBIOSTable : public CommandInterface
                 case PLDM_BIOS_ENUMERATION:
                 case PLDM_BIOS_ENUMERATION_READ_ONLY:
                 {
-
-                    auto count =
-                        pldm_bios_table_attr_value_entry_enum_decode_number(
-                            tableEntry);
-                    std::vector<uint8_t> handles(count);
-                    pldm_bios_table_attr_value_entry_enum_decode_handles(
-                        tableEntry, handles.data(), handles.size());
-                    std::cout << "\tNumberOfCurrentValues: " << (int)count
+                    auto handles = entry.currentIndices();
+                    std::cout << "\tNumberOfCurrentValues: " << handles.size()
                               << std::endl;
                     for (size_t i = 0; i < handles.size(); i++)
                     {
@@ -519,27 +520,17 @@ class GetBIOSTable : public CommandInterface
                 case PLDM_BIOS_INTEGER:
                 case PLDM_BIOS_INTEGER_READ_ONLY:
                 {
-                    auto cv =
-                        pldm_bios_table_attr_value_entry_integer_decode_cv(
-                            tableEntry);
-                    std::cout << "\tCurrentValue: " << cv << std::endl;
+                    std::cout << "\tCurrentValue: " << entry.currentValue()
+                              << std::endl;
                     break;
                 }
                 case PLDM_BIOS_STRING:
                 case PLDM_BIOS_STRING_READ_ONLY:
                 {
-                    auto stringLength =
-                        pldm_bios_table_attr_value_entry_string_decode_length(
-                            tableEntry);
-                    variable_field currentString;
-                    pldm_bios_table_attr_value_entry_string_decode_string(
-                        tableEntry, &currentString);
-                    std::cout << "\tCurrentStringLength: " << stringLength
-                              << std::endl
-                              << "\tCurrentString: "
-                              << std::string(reinterpret_cast<const char*>(
-                                                 currentString.ptr),
-                                             currentString.length)
+                    auto currentString = entry.currentString();
+                    std::cout << "\tCurrentStringLength: "
+                              << currentString.size() << std::endl
+                              << "\tCurrentString: " << currentString
                               << std::endl;
 
                     break;
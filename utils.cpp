@@ -3,7 +3,11 @@
 #include <array>
 #include <ctime>
 #include <iostream>
+#include <iterator>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <sdbusplus/bus/match.hpp>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -18,6 +22,175 @@ constexpr auto mapperBusName = "xyz.openbmc_project.ObjectMapper";
 constexpr auto mapperPath = "/xyz/openbmc_project/object_mapper";
 constexpr auto mapperInterface = "xyz.openbmc_project.ObjectMapper";
 
+namespace
+{
+
+/** @struct ServiceWatches
+ *
+ *  Subscriptions to the signals invalidating the service cache
+ */
+struct ServiceWatches
+{
+    std::mutex mutex;
+    /** @brief InterfacesAdded and InterfacesRemoved, empty until the cache
+     *         is first filled
+     */
+    std::vector<std::unique_ptr<sdbusplus::bus::match::match>> objects;
+    /** @brief NameOwnerChanged of each service cached so far, by service */
+    std::map<std::string, std::unique_ptr<sdbusplus::bus::match::match>>
+        owners;
+};
+
+/** @brief Get the subscriptions, made once for the whole process */
+ServiceWatches& getServiceWatches()
+{
+    static ServiceWatches watches;
+    return watches;
+}
+
+/** @brief Subscribe to the signals of objects changing interfaces, once
+ *
+ *  @param[in] cache - the service cache
+ */
+void watchObjects(ServiceCache& cache)
+{
+    auto& watches = getServiceWatches();
+    std::lock_guard<std::mutex> lock(watches.mutex);
+    if (!watches.objects.empty())
+    {
+        return;
+    }
+
+    using namespace sdbusplus::bus::match::rules;
+    auto& bus = DBusHandler::getBus();
+    for (const auto& rule : {interfacesAdded(), interfacesRemoved()})
+    {
+        watches.objects.emplace_back(
+            std::make_unique<sdbusplus::bus::match::match>(
+                bus, rule, [&cache](sdbusplus::message::message& msg) {
+                    sdbusplus::message::object_path path;
+                    try
+                    {
+                        msg.read(path);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        return;
+                    }
+                    cache.erasePath(path);
+                }));
+    }
+}
+
+/** @brief Subscribe to the owner changes of a service, once per service
+ *
+ *  The match is on the service name, so the owner changes of the unique
+ *  connection names and of the services not cached don't wake us up.
+ *
+ *  @param[in] cache - the service cache
+ *  @param[in] service - service name
+ */
+void watchOwner(ServiceCache& cache, const std::string& service)
+{
+    auto& watches = getServiceWatches();
+    std::lock_guard<std::mutex> lock(watches.mutex);
+    if (watches.owners.count(service))
+    {
+        return;
+    }
+
+    using namespace sdbusplus::bus::match::rules;
+    watches.owners.emplace(
+        service, std::make_unique<sdbusplus::bus::match::match>(
+                     DBusHandler::getBus(), nameOwnerChanged(service),
+                     [&cache, service](sdbusplus::message::message&) {
+                         cache.eraseService(service);
+                     }));
+}
+
+} // namespace
+
+ServiceCache::ServiceCache(size_t maxSize) : maxSize(maxSize)
+{
+}
+
+std::optional<std::string> ServiceCache::find(const std::string& path,
+                                              const std::string& interface)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = index.find({path, interface});
+    if (iter == index.end())
+    {
+        misses++;
+        return std::nullopt;
+    }
+    hits++;
+    entries.splice(entries.begin(), entries, iter->second);
+    return iter->second->second;
+}
+
+void ServiceCache::insert(const std::string& path,
+                          const std::string& interface,
+                          const std::string& service)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    Key key{path, interface};
+    auto iter = index.find(key);
+    if (iter != index.end())
+    {
+        iter->second->second = service;
+        entries.splice(entries.begin(), entries, iter->second);
+        return;
+    }
+    if (maxSize == 0)
+    {
+        return;
+    }
+    if (entries.size() >= maxSize)
+    {
+        erase(std::prev(entries.end()));
+        evictions++;
+    }
+    entries.emplace_front(key, service);
+    index.emplace(std::move(key), entries.begin());
+}
+
+void ServiceCache::eraseService(const std::string& service)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto iter = entries.begin(); iter != entries.end();)
+    {
+        auto entry = iter++;
+        if (entry->second == service)
+        {
+            erase(entry);
+        }
+    }
+}
+
+void ServiceCache::erasePath(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto iter = index.lower_bound({path, ""});
+    while (iter != index.end() && iter->first.first == path)
+    {
+        entries.erase(iter->second);
+        iter = index.erase(iter);
+    }
+}
+
+ServiceCache::Stats ServiceCache::stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return {hits, misses, evictions, entries.size()};
+}
+
+void ServiceCache::erase(Entries::iterator entry)
+{
+    index.erase(entry->first);
+    entries.erase(entry);
+}
+
 uint8_t getNumPadBytes(uint32_t data)
 {
     uint8_t pad;
@@ -75,6 +248,14 @@ std::optional<std::vector<set_effecter_state_field>>
 std::string DBusHandler::getService(const char* path,
                                     const char* interface) const
 {
+    auto& cache = getServiceCache();
+    if (auto service = cache.find(path, interface))
+    {
+        return *service;
+    }
+    // Subscribe before looking up, so no change goes unnoticed
+    watchObjects(cache);
+
     using DbusInterfaceList = std::vector<std::string>;
     std::map<std::string, std::vector<std::string>> mapperResponse;
     auto& bus = DBusHandler::getBus();
@@ -85,7 +266,15 @@ std::string DBusHandler::getService(const char* path,
 
     auto mapperResponseMsg = bus.call(mapper);
     mapperResponseMsg.read(mapperResponse);
-    return mapperResponse.begin()->first;
+    if (mapperResponse.empty())
+    {
+        throw std::runtime_error("No service found by the object mapper");
+    }
+    const auto& service = mapperResponse.begin()->first;
+    // The service is only known now, it is watched before it is cached
+    watchOwner(cache, service);
+    cache.insert(path, interface, service);
+    return service;
 }
 
 void reportError(const char* errorMsg)
@@ -6,8 +6,13 @@
 
 #include <exception>
 #include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <sdbusplus/server.hpp>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 #include <xyz/openbmc_project/Logging/Entry/server.hpp>
@@ -117,6 +122,85 @@ T decimalToBcd(T decimal)
 
 constexpr auto dbusProperties = "org.freedesktop.DBus.Properties";
 
+/** @class ServiceCache
+ *
+ *  @brief Services found by the object mapper, by object path and interface
+ *
+ *  The cache holds up to maxSize entries and evicts the least recently used
+ *  one to make room. It is safe to use from several threads.
+ */
+class ServiceCache
+{
+  public:
+    /** @struct Stats
+     *
+     *  Usage statistics of the cache
+     */
+    struct Stats
+    {
+        uint64_t hits;
+        uint64_t misses;
+        uint64_t evictions;
+        size_t size;
+    };
+
+    /** @brief Ctor
+     *
+     *  @param[in] maxSize - maximum number of entries
+     */
+    explicit ServiceCache(size_t maxSize = 256);
+
+    /** @brief Find the service of an object path and interface
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interface - D-Bus interface
+     *  @return the service, std::nullopt if not cached
+     */
+    std::optional<std::string> find(const std::string& path,
+                                     const std::string& interface);
+
+    /** @brief Cache the service of an object path and interface
+     *
+     *  @param[in] path - D-Bus object path
+     *  @param[in] interface - D-Bus interface
+     *  @param[in] service - service implementing the interface at the path
+     */
+    void insert(const std::string& path, const std::string& interface,
+                const std::string& service);
+
+    /** @brief Drop the entries of a service, e.g. when its owner changes
+     *
+     *  @param[in] service - service name
+     */
+    void eraseService(const std::string& service);
+
+    /** @brief Drop the entries of an object path, e.g. when interfaces are
+     *         added to or removed from the object
+     *
+     *  @param[in] path - D-Bus object path
+     */
+    void erasePath(const std::string& path);
+
+    /** @brief Get the usage statistics of the cache */
+    Stats stats() const;
+
+  private:
+    using Key = std::pair<std::string, std::string>;
+    using Entries = std::list<std::pair<Key, std::string>>;
+
+    /** @brief Drop an entry, mutex held */
+    void erase(Entries::iterator entry);
+
+    size_t maxSize;
+    /** @brief Entries, most recently used first */
+    Entries entries;
+    std::map<Key, Entries::iterator> index;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    mutable std::mutex mutex;
+};
+
 /**
  *  @class DBusHandler
  *
@@ -136,8 +220,19 @@ class DBusHandler
         return bus;
     }
 
+    /** @brief Get the cache of the services found by the object mapper */
+    static ServiceCache& getServiceCache()
+    {
+        static ServiceCache cache;
+        return cache;
+    }
+
     /**
      *  @brief Get the DBUS Service name for the input dbus path
+     *
+     *  The services are cached, and dropped from the cache when the owner of
+     *  their name changes or interfaces come and go on their object.
+     *
      *  @param[in] path - DBUS object path
      *  @param[in] interface - DBUS Interface
      *  @return std::string - the dbus service name